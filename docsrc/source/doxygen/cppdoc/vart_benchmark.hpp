@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "vart_runner_factory.hpp"
+#include "vart_runner_pool.hpp"
+#include "vart_stats.hpp"
+
+namespace vart {
+
+/**
+ * @enum SubmitMode
+ * @brief Enumerates the job submission modes exercised by RunnerBenchmark.
+ *
+ * - SYNC:           Runner::execute(), one job at a time.
+ * - ASYNC_HANDLE:   Runner::execute_async() followed by Runner::wait() on the
+ * returned JobHandle.
+ * - ASYNC_CALLBACK: Runner::execute_async() with an ExecuteAsyncCallback.
+ */
+enum class SubmitMode { SYNC, ASYNC_HANDLE, ASYNC_CALLBACK };
+
+/**
+ * @struct RunnerBenchmarkConfig
+ * @brief Configuration of a RunnerBenchmark run.
+ *
+ * The benchmark runs every combination of submit_modes, batch_sizes and
+ * queue_depths. Queue depth is the maximum number of jobs in flight; it is
+ * ignored for SubmitMode::SYNC.
+ *
+ * @var RunnerBenchmarkConfig::submit_modes
+ *   Submission modes to measure.
+ * @var RunnerBenchmarkConfig::batch_sizes
+ *   Number of batch entries per job. Each value must not exceed
+ * Runner::get_batch_size().
+ * @var RunnerBenchmarkConfig::queue_depths
+ *   Maximum number of jobs in flight for the asynchronous modes.
+ * @var RunnerBenchmarkConfig::num_jobs
+ *   Number of measured jobs per combination.
+ * @var RunnerBenchmarkConfig::warmup_jobs
+ *   Number of jobs submitted and discarded before measuring each combination.
+ * @var RunnerBenchmarkConfig::timeout
+ *   Timeout in milliseconds passed to Runner::wait() and to the callback
+ * variant of Runner::execute_async().
+ */
+struct RunnerBenchmarkConfig {
+  std::vector<SubmitMode> submit_modes = {SubmitMode::SYNC,
+                                          SubmitMode::ASYNC_HANDLE,
+                                          SubmitMode::ASYNC_CALLBACK};
+  std::vector<size_t> batch_sizes = {1};
+  std::vector<uint32_t> queue_depths = {1, 4, 16};
+  uint32_t num_jobs = 1000;
+  uint32_t warmup_jobs = 50;
+  unsigned int timeout = 10000;
+};
+
+/**
+ * @struct RunnerBenchmarkResult
+ * @brief Result of one RunnerBenchmark combination.
+ *
+ * @var RunnerBenchmarkResult::mode
+ *   Submission mode.
+ * @var RunnerBenchmarkResult::batch_size
+ *   Number of batch entries per job.
+ * @var RunnerBenchmarkResult::queue_depth
+ *   Maximum number of jobs in flight. Always 1 for SubmitMode::SYNC.
+ * @var RunnerBenchmarkResult::latency
+ *   Job latency, measured from submission to completion as observed by the
+ * caller.
+ * @var RunnerBenchmarkResult::jobs_per_sec
+ *   Completed jobs per second.
+ * @var RunnerBenchmarkResult::failed_jobs
+ *   Number of jobs that did not return StatusCode::SUCCESS.
+ */
+struct RunnerBenchmarkResult {
+  SubmitMode mode;
+  size_t batch_size;
+  uint32_t queue_depth;
+  LatencySummary latency;
+  double jobs_per_sec;
+  uint64_t failed_jobs;
+};
+
+/**
+ * @class RunnerBenchmark
+ * @brief Measures the latency and throughput of a Runner.
+ *
+ * RunnerBenchmark allocates host input and output tensors matching the
+ * TensorType::CPU tensor information of the runner, then submits jobs in each
+ * configured mode and reports p50/p99 latency and jobs per second.
+ *
+ * Combined with RunnerType::CPU_REF, it measures the host-side overhead of the
+ * runtime in isolation from the NPU, giving a reproducible number for host-side
+ * performance changes on any build machine.
+ */
+class RunnerBenchmark {
+ public:
+  /**
+   * @brief Constructs a RunnerBenchmark for the given runner.
+   *
+   * @param runner The runner to benchmark.
+   * @param config Benchmark configuration.
+   */
+  RunnerBenchmark(std::shared_ptr<Runner> runner,
+                  const RunnerBenchmarkConfig& config = {});
+
+  /**
+   * @brief Runs all configured combinations.
+   *
+   * @return One RunnerBenchmarkResult per combination, in the order
+   * submit_modes x batch_sizes x queue_depths.
+   */
+  std::vector<RunnerBenchmarkResult> run();
+
+  /**
+   * @brief Prints results as a table.
+   *
+   * @param results Results returned by run().
+   * @param os Output stream. Defaults to std::cout.
+   */
+  static void print_report(const std::vector<RunnerBenchmarkResult>& results,
+                           std::ostream& os = std::cout);
+
+  /**
+   * @brief Measures how throughput scales with the number of runner
+   * instances.
+   *
+   * Creates a RunnerPool with 1 to max_instances instances and runs the
+   * benchmark on each. Use queue depths of at least max_instances, so that
+   * all instances can be kept busy.
+   *
+   * @param device The type of runner to create for each instance.
+   * @param model_path The file system path to the model.
+   * @param max_instances Largest number of instances to measure.
+   * @param config Benchmark configuration used for each pool size.
+   * @param options Options passed to RunnerPool::create().
+   * @return Results of each pool size, indexed by number of instances minus
+   * one.
+   */
+  static std::vector<std::vector<RunnerBenchmarkResult>> run_scaling(
+      RunnerType device,
+      const std::string& model_path,
+      uint32_t max_instances,
+      const RunnerBenchmarkConfig& config = {},
+      const std::unordered_map<std::string, std::any>& options = {});
+
+ private:
+  std::shared_ptr<Runner> runner_;  // Runner under test
+  RunnerBenchmarkConfig config_;    // Benchmark configuration
+};
+
+}  // namespace vart
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "vart_npu_tensor.hpp"
+#include "vart_runner_factory.hpp"
+#include "vart_stats.hpp"
+
+namespace vart {
+
+/**
+ * @struct ResultCacheConfig
+ * @brief Configuration of a CachingRunner.
+ *
+ * @var ResultCacheConfig::max_bytes
+ *   Maximum size of the cached output tensors. The least recently used
+ * entries are evicted beyond it.
+ * @var ResultCacheConfig::tolerances
+ *   Per-input tolerance, keyed by input tensor name, in units of the tensor
+ * data type. Before hashing, values of floating-point tensors are rounded to
+ * multiples of 2 * tolerance, and values of integer tensors to multiples of
+ * 2 * floor(tolerance) + 1, so inputs differing by sensor noise usually share
+ * a key. A tolerance of 0, and a tolerance below 1 for an integer tensor,
+ * hashes the input exactly, as for inputs not listed.
+ * @var ResultCacheConfig::ignored_inputs
+ *   Names of the input tensors left out of the key, for example a constant
+ * prompt that never changes for the lifetime of the runner.
+ */
+struct ResultCacheConfig {
+  size_t max_bytes = 64 * 1024 * 1024;
+  std::unordered_map<std::string, double> tolerances;
+  std::vector<std::string> ignored_inputs;
+};
+
+/**
+ * @struct ResultCacheStats
+ * @brief Counters of a CachingRunner.
+ *
+ * @var ResultCacheStats::lookups
+ *   Number of batch entries looked up in the cache.
+ * @var ResultCacheStats::hits
+ *   Number of batch entries served from the cache.
+ * @var ResultCacheStats::evictions
+ *   Number of entries evicted.
+ * @var ResultCacheStats::cached_bytes
+ *   Current size of the cached output tensors.
+ * @var ResultCacheStats::bytes_saved
+ *   Input and output bytes not transferred to or from the device thanks to
+ * hits.
+ * @var ResultCacheStats::hash_us
+ *   Time spent hashing the inputs of each job.
+ * @var ResultCacheStats::hash_gbps
+ *   Mean hashing throughput in GB/s.
+ */
+struct ResultCacheStats {
+  uint64_t lookups;
+  uint64_t hits;
+  uint64_t evictions;
+  uint64_t cached_bytes;
+  uint64_t bytes_saved;
+  LatencySummary hash_us;
+  double hash_gbps;
+};
+
+/**
+ * @class CachingRunner
+ * @brief Runner memoizing the outputs of repeated inputs.
+ *
+ * Video streams with static scenes and models with repeated inputs, such as
+ * fixed prompts or embeddings, execute the same job many times. CachingRunner
+ * wraps a runner and keys each batch entry on a 128-bit hash of its input
+ * tensors, computed with AVX2 or AVX-512 when available. Entries found in the
+ * cache are served by copying the cached outputs into the output tensors,
+ * without submitting them to the device; the other entries are executed by
+ * the wrapped runner and their outputs are cached.
+ *
+ * Caching is opt-in: only runners wrapped in a CachingRunner are affected.
+ * Output tensors must be in host memory, or in device memory with a host
+ * mapping.
+ */
+class CachingRunner : public Runner {
+ public:
+  /**
+   * @brief Wraps a runner with a result cache.
+   *
+   * @param runner Runner executing the jobs missing the cache.
+   * @param config Cache configuration.
+   * @return std::shared_ptr<CachingRunner> The caching runner.
+   * @throw std::invalid_argument if config names a tensor the runner does not
+   * have.
+   */
+  static std::shared_ptr<CachingRunner> create(
+      std::shared_ptr<Runner> runner,
+      const ResultCacheConfig& config = {});
+
+  ~CachingRunner() override;
+
+  const std::vector<NpuTensorInfo>& get_tensors_info(
+      const TensorDirection& direction,
+      const TensorType& type) const override;
+
+  const NpuTensorInfo& get_tensor_info_by_name(
+      const std::string& tensor_name,
+      const TensorType& type) const override;
+
+  const QuantParameters& get_quant_parameters(
+      const std::string& tensor_name) const override;
+
+  /**
+   * @brief Resolves a tensor name into a handle of the wrapped runner.
+   *
+   * This lookup and the handle-based lookups are forwarded to the wrapped
+   * runner.
+   *
+   * See Runner::get_tensor_handle().
+   */
+  TensorHandle get_tensor_handle(const std::string& tensor_name) const override;
+
+  const NpuTensorInfo& get_tensor_info_by_handle(
+      const TensorHandle& handle,
+      const TensorType& type) const override;
+
+  const QuantParameters& get_quant_parameters_by_handle(
+      const TensorHandle& handle) const override;
+
+  /**
+   * @brief Returns the device of the wrapped runner.
+   *
+   * See Runner::get_device().
+   */
+  std::shared_ptr<Device> get_device() const override;
+
+  size_t get_num_input_tensors() const override;
+
+  size_t get_num_output_tensors() const override;
+
+  size_t get_batch_size() const override;
+
+  /**
+   * @brief Serves the cached batch entries and executes the others.
+   *
+   * See Runner::execute().
+   */
+  StatusCode execute(const std::vector<std::vector<NpuTensor>>& inputs,
+                     std::vector<std::vector<NpuTensor>>& outputs) override;
+
+  /**
+   * @brief Serves the cached batch entries and submits the others.
+   *
+   * A job whose entries are all cached completes immediately. See
+   * Runner::execute_async().
+   */
+  JobHandle execute_async(
+      const std::vector<std::vector<NpuTensor>>& inputs,
+      std::vector<std::vector<NpuTensor>>& outputs) override;
+
+  StatusCode wait(const JobHandle& job_handle, unsigned int timeout) override;
+
+  /**
+   * @brief Serves the cached batch entries and submits the others with a
+   * completion callback.
+   *
+   * When all the entries of the job are cached, cb is called with
+   * StatusCode::SUCCESS on the calling thread before execute_async() returns.
+   * Otherwise, it is called as described for Runner::execute_async(). See
+   * Runner::execute_async().
+   */
+  StatusCode execute_async(const std::vector<std::vector<NpuTensor>>& inputs,
+                           std::vector<std::vector<NpuTensor>>& outputs,
+                           ExecuteAsyncCallback cb,
+                           unsigned int timeout) override;
+
+  /**
+   * @brief Returns the data movement counters of the wrapped runner.
+   *
+   * Batch entries served from the cache move no data through the wrapped
+   * runner and are not counted; see ResultCacheStats::bytes_saved.
+   *
+   * @return TransferStats The counters of the wrapped runner.
+   */
+  TransferStats get_transfer_stats() const override;
+
+  /**
+   * @brief Resets the data movement counters of the wrapped runner.
+   */
+  void reset_transfer_stats() override;
+
+  /**
+   * @brief Drops all cached entries.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the cache counters.
+   *
+   * @return ResultCacheStats A snapshot of the counters.
+   */
+  ResultCacheStats get_stats() const;
+
+  /**
+   * @brief Resets the cache counters.
+   */
+  void reset_stats();
+
+ private:
+  CachingRunner(std::shared_ptr<Runner> runner,
+                const ResultCacheConfig& config);
+
+  struct Cache;
+  std::shared_ptr<Runner> runner_;  // Wrapped runner
+  std::unique_ptr<Cache> cache_;    // LRU map from input hash to outputs
+};
+
+}  // namespace vart
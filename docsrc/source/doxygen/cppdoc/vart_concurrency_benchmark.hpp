@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "vart_runner_factory.hpp"
+#include "vart_stats.hpp"
+
+namespace vart {
+
+/**
+ * @enum ConcurrencyMode
+ * @brief Enumerates the ways the concurrency benchmark drives in-flight
+ * requests.
+ *
+ * - THREAD_PER_REQUEST: One thread per in-flight request, blocked in
+ * Runner::execute().
+ * - COROUTINE: One event-loop thread driving all requests with co_execute().
+ */
+enum class ConcurrencyMode { THREAD_PER_REQUEST, COROUTINE };
+
+/**
+ * @struct ConcurrencyBenchmarkResult
+ * @brief Result of one concurrency benchmark configuration.
+ *
+ * @var ConcurrencyBenchmarkResult::mode
+ *   Concurrency mode used.
+ * @var ConcurrencyBenchmarkResult::concurrency
+ *   Number of requests kept in flight.
+ * @var ConcurrencyBenchmarkResult::num_threads
+ *   Number of application threads used to drive the requests.
+ * @var ConcurrencyBenchmarkResult::requests_per_second
+ *   Completed requests per second.
+ * @var ConcurrencyBenchmarkResult::latency
+ *   Request latency, from submission to the resumption of the requester.
+ * @var ConcurrencyBenchmarkResult::cpu_utilization
+ *   Process CPU time divided by wall-clock time.
+ */
+struct ConcurrencyBenchmarkResult {
+  ConcurrencyMode mode;
+  uint32_t concurrency;
+  uint32_t num_threads;
+  double requests_per_second;
+  LatencySummary latency;
+  double cpu_utilization;
+};
+
+/**
+ * @class ConcurrencyBenchmark
+ * @brief Echo-server-style benchmark of request concurrency.
+ *
+ * Simulates clients that each send a request, wait for the result and send
+ * the next one, and compares one thread per request with coroutines resumed
+ * on a single event loop. The COROUTINE mode requires the library to be built
+ * with C++20.
+ */
+class ConcurrencyBenchmark {
+ public:
+  /**
+   * @brief Runs the concurrency benchmark.
+   *
+   * @param runner Runner to benchmark.
+   * @param concurrency_levels Numbers of requests to keep in flight, for
+   * example {1, 16, 128, 512}.
+   * @param modes Concurrency modes to measure.
+   * @param duration_ms Measured duration of each configuration in milliseconds.
+   * @return One ConcurrencyBenchmarkResult per mode and concurrency level.
+   */
+  static std::vector<ConcurrencyBenchmarkResult> run(
+      std::shared_ptr<Runner> runner,
+      const std::vector<uint32_t>& concurrency_levels,
+      const std::vector<ConcurrencyMode>& modes =
+          {ConcurrencyMode::THREAD_PER_REQUEST, ConcurrencyMode::COROUTINE},
+      uint32_t duration_ms = 5000);
+
+  /**
+   * @brief Prints results as a table.
+   *
+   * @param results Results returned by run().
+   * @param os Output stream. Defaults to std::cout.
+   */
+  static void print_report(
+      const std::vector<ConcurrencyBenchmarkResult>& results,
+      std::ostream& os = std::cout);
+};
+
+}  // namespace vart
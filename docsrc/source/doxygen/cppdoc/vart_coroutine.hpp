@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#if __cplusplus >= 202002L
+
+#include <coroutine>
+#include <functional>
+#include <memory>
+#include <stop_token>
+#include <vector>
+
+#include "vart_npu_tensor.hpp"
+#include "vart_runner_factory.hpp"
+
+namespace vart {
+
+/**
+ * @brief Function that runs a task on the thread or event loop of the caller.
+ *
+ * The executor is called from a runtime thread when a job completes. It must
+ * not run the task inline; it should post it to the caller's event loop, for
+ * example with asio::post() or by pushing it to a queue drained by the loop.
+ */
+using Executor = std::function<void(std::function<void()>)>;
+
+/**
+ * @class ExecuteAwaitable
+ * @brief Awaitable returned by co_execute().
+ *
+ * Awaiting it submits the job with Runner::execute_async() and suspends the
+ * awaiting coroutine without blocking a thread. The coroutine is resumed
+ * through the executor once the runner has invoked the completion callback of
+ * the job, whether the job succeeded, failed or timed out, and co_await yields
+ * the StatusCode of the job.
+ *
+ * Runner has no API to cancel a submitted job, so the coroutine is never
+ * resumed while the runner may still access the tensors of the job. A stop
+ * request received after submission does not shorten the wait: the job runs
+ * to completion or to its timeout, its outputs are discarded and co_await
+ * yields StatusCode::TIMEOUT. A stop request received before submission skips
+ * the job and resumes the coroutine immediately with StatusCode::TIMEOUT.
+ *
+ * An ExecuteAwaitable is awaited at most once. It is not copyable.
+ */
+class ExecuteAwaitable {
+ public:
+  ExecuteAwaitable(Runner& runner,
+                   const std::vector<std::vector<NpuTensor>>& inputs,
+                   std::vector<std::vector<NpuTensor>>& outputs,
+                   Executor executor,
+                   unsigned int timeout,
+                   std::stop_token stop_token);
+
+  ExecuteAwaitable(ExecuteAwaitable&& other) noexcept;
+  ExecuteAwaitable(const ExecuteAwaitable& other) = delete;
+  ExecuteAwaitable& operator=(const ExecuteAwaitable& other) = delete;
+  ~ExecuteAwaitable();
+
+  /**
+   * @brief Always returns false: the job is submitted on suspension.
+   */
+  bool await_ready() const noexcept;
+
+  /**
+   * @brief Submits the job and arranges for the coroutine to be resumed.
+   *
+   * @param handle Handle of the awaiting coroutine.
+   * @return false if the job was not submitted, because the submission failed
+   * or a stop was already requested, and the coroutine should resume
+   * immediately; true otherwise.
+   */
+  bool await_suspend(std::coroutine_handle<> handle);
+
+  /**
+   * @brief Returns the status of the job.
+   *
+   * @return StatusCode SUCCESS if the job completed, TIMEOUT if the runner
+   * reported a timeout or a stop was requested through the stop token, or the
+   * error reported by the runner.
+   */
+  StatusCode await_resume() const noexcept;
+
+ private:
+  struct State;
+  std::shared_ptr<State> state_;  // Shared with the completion callback
+};
+
+/**
+ * @brief Executes a job from a coroutine.
+ *
+ * @code
+ * vart::StatusCode status = co_await vart::co_execute(
+ *     *runner, inputs, outputs, executor, 1000, stop_token);
+ * @endcode
+ *
+ * One thread running an event loop can drive hundreds of jobs concurrently
+ * this way, instead of one thread per job blocked in Runner::wait().
+ *
+ * @param runner Runner executing the job.
+ * @param inputs Input tensors. They must remain valid until the coroutine is
+ * resumed, which happens only after the runner has completed the job.
+ * @param outputs Output tensors. They must remain valid until the coroutine is
+ * resumed, which happens only after the runner has completed the job.
+ * @param executor Executor on which the coroutine is resumed.
+ * @param timeout The maximum time in milliseconds for the job, passed to
+ * Runner::execute_async().
+ * @param stop_token Token used to cancel the job. A cancelled job yields
+ * StatusCode::TIMEOUT and its output tensors must not be used; see
+ * ExecuteAwaitable for when the coroutine is resumed.
+ * @return ExecuteAwaitable Awaitable yielding the StatusCode of the job.
+ */
+ExecuteAwaitable co_execute(Runner& runner,
+                            const std::vector<std::vector<NpuTensor>>& inputs,
+                            std::vector<std::vector<NpuTensor>>& outputs,
+                            Executor executor,
+                            unsigned int timeout,
+                            std::stop_token stop_token = {});
+
+}  // namespace vart
+
+#endif  // __cplusplus >= 202002L
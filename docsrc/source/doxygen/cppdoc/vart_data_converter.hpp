@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "vart_npu_tensor.hpp"
+#include "vart_runner_factory.hpp"
+
+namespace vart {
+
+/**
+ * @enum CpuIsa
+ * @brief Enumerates the host instruction sets used by the VART host kernels.
+ *
+ * - SCALAR:  Portable scalar implementation, available on every host.
+ * - SSE4:    SSE4.1 implementation.
+ * - AVX2:    AVX2 implementation (with F16C for FP16 conversions).
+ * - AVX512:  AVX-512 (F, BW, VL) implementation.
+ */
+enum class CpuIsa { SCALAR, SSE4, AVX2, AVX512 };
+
+/**
+ * @class DataConverter
+ * @brief Vectorized conversion kernels between tensor data types.
+ *
+ * DataConverter converts tensor data between any pair of DataType values on
+ * the host, using the QuantParameters returned by
+ * Runner::get_quant_parameters():
+ *
+ * - Quantization from BF16, FP16 or FLOAT32 to an integer type computes
+ * round(x / scale) + zero_point and saturates to the range of the destination
+ * type.
+ * - Dequantization from an integer type to BF16, FP16 or FLOAT32 computes
+ * (q - zero_point) * scale.
+ * - Conversion between two integer types dequantizes with the source
+ * parameters and quantizes with the destination parameters.
+ * - Conversion between floating-point types ignores the quantization
+ * parameters; narrowing conversions use the rounding mode of the destination
+ * parameters.
+ *
+ * RoundingMode::ROUND_TO_NEAREST_EVEN and RoundingMode::ROUND_TOWARD_ZERO are
+ * honoured bit-exactly: every instruction set produces the same output as the
+ * scalar implementation. RoundingMode::UNKNOWN is treated as
+ * ROUND_TO_NEAREST_EVEN.
+ *
+ * The implementation is selected once at runtime from the instruction sets
+ * supported by the host, and can be overridden with set_isa().
+ */
+class DataConverter {
+ public:
+  /**
+   * @brief Converts a contiguous array of elements.
+   *
+   * @param src Pointer to the source elements.
+   * @param src_type Data type of the source elements.
+   * @param src_params Quantization parameters of the source. Ignored for
+   * floating-point source types.
+   * @param dst Pointer to the destination elements. Must not overlap src
+   * unless both types have the same size.
+   * @param dst_type Data type of the destination elements.
+   * @param dst_params Quantization parameters of the destination. Only the
+   * rounding mode is used for floating-point destination types.
+   * @param count Number of elements to convert.
+   * @return StatusCode::SUCCESS, or StatusCode::INVALID_INPUT if a type is
+   * DataType::UNKNOWN or a scale is zero.
+   */
+  static StatusCode convert(const void* src,
+                            const DataType& src_type,
+                            const QuantParameters& src_params,
+                            void* dst,
+                            const DataType& dst_type,
+                            const QuantParameters& dst_params,
+                            size_t count);
+
+  /**
+   * @brief Converts the data of a tensor into another tensor.
+   *
+   * The data types are taken from the tensor metadata. Both tensors must hold
+   * the same number of elements in the same memory layout, and must be
+   * accessible from the host (see NpuTensor::get_buffer()).
+   *
+   * @param src Source tensor.
+   * @param src_params Quantization parameters of the source tensor.
+   * @param dst Destination tensor.
+   * @param dst_params Quantization parameters of the destination tensor.
+   * @return StatusCode::SUCCESS, or StatusCode::INVALID_INPUT if the tensors
+   * do not match.
+   */
+  static StatusCode convert(const NpuTensor& src,
+                            const QuantParameters& src_params,
+                            NpuTensor& dst,
+                            const QuantParameters& dst_params);
+
+  /**
+   * @brief Quantizes a floating-point tensor.
+   *
+   * Equivalent to convert() with params as destination parameters.
+   *
+   * @param src Source tensor of type BF16, FP16 or FLOAT32.
+   * @param dst Destination tensor of an integer type.
+   * @param params Quantization parameters of the destination tensor.
+   * @return StatusCode The status of the conversion.
+   */
+  static StatusCode quantize(const NpuTensor& src,
+                             NpuTensor& dst,
+                             const QuantParameters& params);
+
+  /**
+   * @brief Dequantizes an integer tensor.
+   *
+   * Equivalent to convert() with params as source parameters.
+   *
+   * @param src Source tensor of an integer type.
+   * @param dst Destination tensor of type BF16, FP16 or FLOAT32.
+   * @param params Quantization parameters of the source tensor.
+   * @return StatusCode The status of the conversion.
+   */
+  static StatusCode dequantize(const NpuTensor& src,
+                               NpuTensor& dst,
+                               const QuantParameters& params);
+
+  /**
+   * @brief Returns the instruction set used by the conversion kernels.
+   *
+   * @return CpuIsa The selected instruction set.
+   */
+  static CpuIsa get_isa();
+
+  /**
+   * @brief Overrides the instruction set used by the conversion kernels.
+   *
+   * Intended for testing and benchmarking. Instruction sets not supported by
+   * the host fall back to the best supported one below them.
+   *
+   * @param isa The instruction set to use.
+   * @return CpuIsa The instruction set actually selected.
+   */
+  static CpuIsa set_isa(const CpuIsa& isa);
+};
+
+}  // namespace vart
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "vart_data_converter.hpp"
+
+namespace vart {
+
+/**
+ * @struct ConvertBenchmarkResult
+ * @brief Throughput of one DataConverter kernel.
+ *
+ * @var ConvertBenchmarkResult::src_type
+ *   Source data type.
+ * @var ConvertBenchmarkResult::dst_type
+ *   Destination data type.
+ * @var ConvertBenchmarkResult::isa
+ *   Instruction set of the measured kernel.
+ * @var ConvertBenchmarkResult::gbytes_per_sec
+ *   Throughput in gigabytes per second, counting source and destination bytes.
+ */
+struct ConvertBenchmarkResult {
+  DataType src_type;
+  DataType dst_type;
+  CpuIsa isa;
+  double gbytes_per_sec;
+};
+
+/**
+ * @class ConvertBenchmark
+ * @brief Measures the throughput of the DataConverter kernels.
+ *
+ * Runs every pair of data types with every instruction set supported by the
+ * host, converting num_elements elements per iteration.
+ */
+class ConvertBenchmark {
+ public:
+  /**
+   * @brief Runs the conversion microbenchmark.
+   *
+   * @param num_elements Number of elements converted per iteration. Use a
+   * size larger than the last-level cache to measure memory-bound throughput.
+   * @param iterations Number of measured iterations per kernel.
+   * @return One ConvertBenchmarkResult per kernel and instruction set.
+   */
+  static std::vector<ConvertBenchmarkResult> run(size_t num_elements,
+                                                 uint32_t iterations = 20);
+
+  /**
+   * @brief Prints results as a table.
+   *
+   * @param results Results returned by run().
+   * @param os Output stream. Defaults to std::cout.
+   */
+  static void print_report(const std::vector<ConvertBenchmarkResult>& results,
+                           std::ostream& os = std::cout);
+};
+
+}  // namespace vart
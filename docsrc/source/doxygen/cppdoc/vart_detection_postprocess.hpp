@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vart_device.hpp"
+#include "vart_postprocess.hpp"
+#include "vart_result_arena.hpp"
+
+namespace vart {
+
+/**
+ * @struct DetectionPostProcessConfig
+ * @brief Configuration of the host detection post-processing engine.
+ *
+ * The score threshold, IoU threshold and maximum number of detections are
+ * read from the JSON configuration, as for the other PostProcess
+ * implementations.
+ *
+ * @var DetectionPostProcessConfig::num_threads
+ *   Number of threads the batch entries are split across. 0 uses one thread
+ * per available core, up to the batch size.
+ * @var DetectionPostProcessConfig::nms_block_size
+ *   Number of candidate boxes compared at a time by the NMS kernel. 0 selects
+ * a block size such that the block fits in the L1 cache.
+ */
+struct DetectionPostProcessConfig {
+  uint32_t num_threads = 0;
+  uint32_t nms_block_size = 0;
+};
+
+/**
+ * @class DetectionPostProcess
+ * @brief Vectorized host engine decoding detection heads, usable directly or
+ * as a PostProcess.
+ *
+ * The engine processes each batch entry in three steps:
+ * - A prefilter pass compares the raw INT8 outputs with bounds derived once
+ * from the score threshold, without dequantizing them. The score of an anchor
+ * is not a function of a single raw value, so the bounds are conservative:
+ * for PostProcessType::YOLOV2, the score sigmoid(obj) * softmax(cls) is at
+ * most sigmoid(obj), so anchors with raw_obj < q(logit(threshold)) are
+ * discarded; for PostProcessType::SSDRESNET34, the softmax score of a class is
+ * at most sigmoid(cls - background), so anchors with raw_cls - raw_background
+ * < logit(threshold) / scale for every class are discarded. Bounds are
+ * rounded down, so every anchor whose score is above the threshold passes the
+ * prefilter.
+ * - The anchors passing the prefilter are dequantized, rescored and decoded
+ * into boxes with the arithmetic of the reference PostProcess, and those
+ * below the threshold are dropped. The results are stored as separate arrays
+ * of coordinates, scores and labels.
+ * - Non-maximum suppression sorts the candidates by score and compares each
+ * kept box with a block of candidates at a time.
+ *
+ * Batch entries are split across a thread pool. The prefilter and the NMS
+ * overlap tests use AVX2 or AVX-512 when available, selected at runtime with
+ * DataConverter::get_isa(), with a scalar fallback. Rescoring and decoding
+ * use the scalar code of the reference PostProcess. The vectorized IoU
+ * computation performs the same single-precision operations, in the same
+ * order, as the reference, and is compiled without floating-point
+ * contraction, so that no FMA instruction changes the rounding.
+ *
+ * With these constraints, the results are identical to those of the
+ * PostProcess created with the same PostProcessType and JSON configuration,
+ * including the order of the results: boxes of equal score are ordered by
+ * anchor index.
+ *
+ * The engine writes its results into a ResultArena, so a batch of detections
+ * costs no per-result allocation. Use create_engine() and process() to
+ * consume the arena directly. create() wraps the engine in a PostProcess for
+ * drop-in use; its process() converts the arena with
+ * ResultArena::to_infer_results(), which allocates one InferResult per
+ * detection.
+ *
+ * Supported types are PostProcessType::YOLOV2 and
+ * PostProcessType::SSDRESNET34.
+ */
+class DetectionPostProcess {
+ public:
+  /**
+   * @brief Creates a PostProcess module backed by the detection engine.
+   *
+   * The returned module is used as any other PostProcess, including
+   * PostProcess::set_config() and PostProcess::process().
+   *
+   * @param type Type of the detection head.
+   * @param json_data Post-processing configuration, in the same JSON format as
+   * for the other PostProcess implementations.
+   * @param device Handle to the device.
+   * @param config Engine configuration.
+   * @return std::shared_ptr<PostProcess> The created module.
+   * @throw std::invalid_argument if type is not a supported detection head.
+   */
+  static std::shared_ptr<PostProcess> create(
+      PostProcessType type,
+      std::string& json_data,
+      std::shared_ptr<Device> device,
+      const DetectionPostProcessConfig& config = {});
+
+  /**
+   * @brief Creates a detection engine writing its results into a
+   * ResultArena.
+   *
+   * @param type Type of the detection head.
+   * @param json_data Post-processing configuration, in the same JSON format as
+   * for the other PostProcess implementations.
+   * @param device Handle to the device.
+   * @param config Engine configuration.
+   * @return std::unique_ptr<DetectionPostProcess> The created engine.
+   * @throw std::invalid_argument if type is not a supported detection head.
+   */
+  static std::unique_ptr<DetectionPostProcess> create_engine(
+      PostProcessType type,
+      std::string& json_data,
+      std::shared_ptr<Device> device,
+      const DetectionPostProcessConfig& config = {});
+
+  ~DetectionPostProcess();
+
+  DetectionPostProcess(const DetectionPostProcess& other) = delete;
+  DetectionPostProcess& operator=(const DetectionPostProcess& other) = delete;
+
+  /**
+   * @brief Provides the tensor information and batch size of the model.
+   *
+   * Same as PostProcess::set_config(). Must be called once, before
+   * process().
+   *
+   * @param info Information of the output tensors of the model.
+   * @param batch_size Batch size of the model.
+   */
+  void set_config(std::vector<TensorInfo>& info, uint32_t batch_size);
+
+  /**
+   * @brief Decodes a batch of head outputs into an arena.
+   *
+   * The arena is reset to current_batch_size frames and the detections of
+   * each frame are added as top-level results, in the order in which
+   * PostProcess::process() returns them. Once the arena has reached its
+   * capacity, no memory is allocated.
+   *
+   * @param data Output tensors, organized as for PostProcess::process(): the
+   * tensors of one frame in sequence, followed by those of the next frames.
+   * @param current_batch_size Number of valid frames in the batch.
+   * @param results Arena receiving the detections. Label names are taken from
+   * the label table of the arena.
+   */
+  void process(const std::vector<int8_t*>& data,
+               uint32_t current_batch_size,
+               ResultArena& results);
+
+ private:
+  DetectionPostProcess();
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;  // Thread pool, candidate and NMS buffers
+};
+
+}  // namespace vart
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vart_detection_postprocess.hpp"
+#include "vart_stats.hpp"
+
+namespace vart {
+
+/**
+ * @struct PostProcessBenchmarkResult
+ * @brief Comparison of the detection engine with the reference
+ * post-processing for one number of anchors.
+ *
+ * @var PostProcessBenchmarkResult::num_anchors
+ *   Number of anchors of the synthetic head outputs.
+ * @var PostProcessBenchmarkResult::num_detections
+ *   Mean number of detections per batch entry.
+ * @var PostProcessBenchmarkResult::reference_us
+ *   Processing time of the reference PostProcess.
+ * @var PostProcessBenchmarkResult::engine_us
+ *   Processing time of the DetectionPostProcess engine.
+ * @var PostProcessBenchmarkResult::identical
+ *   True if both implementations produced the same results for every
+ * iteration.
+ */
+struct PostProcessBenchmarkResult {
+  uint32_t num_anchors;
+  double num_detections;
+  LatencySummary reference_us;
+  LatencySummary engine_us;
+  bool identical;
+};
+
+/**
+ * @class PostProcessBenchmark
+ * @brief Compares the detection post-processing engine with the reference
+ * PostProcess implementation.
+ *
+ * Head outputs are synthesized from a fixed seed, with a given fraction of the
+ * anchors above the score threshold, so that runs are reproducible.
+ */
+class PostProcessBenchmark {
+ public:
+  /**
+   * @brief Runs the post-processing benchmark.
+   *
+   * @param type Type of the detection head.
+   * @param json_data Post-processing configuration.
+   * @param device Handle to the device.
+   * @param anchor_counts Numbers of anchors to measure.
+   * @param candidate_ratio Fraction of the anchors whose score is above the
+   * threshold.
+   * @param batch_size Number of batch entries per iteration.
+   * @param iterations Number of measured iterations per number of anchors.
+   * @return One PostProcessBenchmarkResult per number of anchors.
+   */
+  static std::vector<PostProcessBenchmarkResult> run(
+      PostProcessType type,
+      std::string& json_data,
+      std::shared_ptr<Device> device,
+      const std::vector<uint32_t>& anchor_counts = {10000, 50000, 100000},
+      double candidate_ratio = 0.01,
+      uint32_t batch_size = 1,
+      uint32_t iterations = 100);
+
+  /**
+   * @brief Prints results as a table.
+   *
+   * @param results Results returned by run().
+   * @param os Output stream. Defaults to std::cout.
+   */
+  static void print_report(
+      const std::vector<PostProcessBenchmarkResult>& results,
+      std::ostream& os = std::cout);
+};
+
+}  // namespace vart
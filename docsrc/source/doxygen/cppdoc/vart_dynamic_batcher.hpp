@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "vart_npu_tensor.hpp"
+#include "vart_runner_factory.hpp"
+#include "vart_stats.hpp"
+
+namespace vart {
+
+/**
+ * @struct DynamicBatcherConfig
+ * @brief Configuration of a DynamicBatcher.
+ *
+ * @var DynamicBatcherConfig::max_delay_us
+ *   Maximum time in microseconds the oldest pending request waits for the
+ * batch to fill up. When the deadline is reached, the partial batch is
+ * submitted.
+ * @var DynamicBatcherConfig::max_pending_requests
+ *   Maximum number of requests waiting to be batched. submit() fails with
+ * StatusCode::OUT_OF_MEMORY beyond this limit.
+ * @var DynamicBatcherConfig::max_inflight_batches
+ *   Maximum number of batches submitted to the runner at the same time.
+ * @var DynamicBatcherConfig::timeout
+ *   Timeout in milliseconds of each batch job.
+ */
+struct DynamicBatcherConfig {
+  uint32_t max_delay_us = 2000;
+  uint32_t max_pending_requests = 256;
+  uint32_t max_inflight_batches = 2;
+  unsigned int timeout = 1000;
+};
+
+/**
+ * @struct DynamicBatcherStats
+ * @brief Statistics used to tune the throughput/latency tradeoff of a
+ * DynamicBatcher.
+ *
+ * @var DynamicBatcherStats::requests
+ *   Number of requests submitted.
+ * @var DynamicBatcherStats::batches
+ *   Number of batches submitted to the runner.
+ * @var DynamicBatcherStats::deadline_flushes
+ *   Number of batches submitted partially filled because max_delay_us was
+ * reached.
+ * @var DynamicBatcherStats::fill_ratio
+ *   Distribution of the number of requests per batch divided by
+ * Runner::get_batch_size().
+ * @var DynamicBatcherStats::queueing_delay_us
+ *   Distribution of the time between submit() and the submission of the batch
+ * containing the request, in microseconds.
+ * @var DynamicBatcherStats::queueing_delay
+ *   Summary of the queueing delay.
+ */
+struct DynamicBatcherStats {
+  uint64_t requests;
+  uint64_t batches;
+  uint64_t deadline_flushes;
+  Histogram fill_ratio;
+  Histogram queueing_delay_us;
+  LatencySummary queueing_delay;
+};
+
+/**
+ * @class DynamicBatcher
+ * @brief Packs single-sample requests from many threads into runner batches.
+ *
+ * The batch size reported by Runner::get_batch_size() is fixed by the model.
+ * DynamicBatcher accepts requests of one batch entry each, from any number of
+ * threads, and packs them into batches of get_batch_size() entries. A batch is
+ * submitted with Runner::execute_async() when it is full, or when its oldest
+ * request has waited max_delay_us. The outcome of each request is delivered
+ * through its own callback.
+ *
+ * The tensors of a request are moved into the batch, without copying the
+ * data they wrap, and handed back to the request callback.
+ */
+class DynamicBatcher {
+ public:
+  /**
+   * @brief Alias for the callback receiving the outcome of a request.
+   *
+   * Invoked from an internal thread once the batch containing the request has
+   * completed.
+   *
+   * @param status The status of the batch job.
+   * @param inputs The input tensors of the request.
+   * @param outputs The output tensors of the request, holding the results
+   * when status is StatusCode::SUCCESS.
+   */
+  using RequestCallback = std::function<void(StatusCode status,
+                                             std::vector<NpuTensor>& inputs,
+                                             std::vector<NpuTensor>& outputs)>;
+
+  /**
+   * @brief Constructs a DynamicBatcher in front of a runner.
+   *
+   * @param runner Runner executing the batches.
+   * @param config Batcher configuration.
+   */
+  DynamicBatcher(std::shared_ptr<Runner> runner,
+                 const DynamicBatcherConfig& config = {});
+
+  /**
+   * @brief Submits the pending requests and waits for all batches to
+   * complete.
+   */
+  ~DynamicBatcher();
+
+  DynamicBatcher(const DynamicBatcher& other) = delete;
+  DynamicBatcher& operator=(const DynamicBatcher& other) = delete;
+
+  /**
+   * @brief Submits a single-sample request.
+   *
+   * @param inputs Input tensors of one batch entry, in the order returned by
+   * Runner::get_tensors_info().
+   * @param outputs Output tensors of one batch entry, in the order returned by
+   * Runner::get_tensors_info().
+   * @param cb Callback receiving the outcome of the request.
+   * @return StatusCode::SUCCESS if the request was queued, or
+   * StatusCode::OUT_OF_MEMORY if max_pending_requests requests are already
+   * pending.
+   *
+   * @note The tensors are only moved from when the request is queued. On
+   * failure, inputs and outputs are left intact and still owned by the caller,
+   * who can resubmit them, and cb is not invoked.
+   */
+  StatusCode submit(std::vector<NpuTensor>&& inputs,
+                    std::vector<NpuTensor>&& outputs,
+                    RequestCallback cb);
+
+  /**
+   * @brief Submits the pending requests immediately, without waiting for the
+   * batch to fill up.
+   */
+  void flush();
+
+  /**
+   * @brief Returns the batching statistics.
+   *
+   * @return DynamicBatcherStats A snapshot of the statistics.
+   */
+  DynamicBatcherStats get_stats() const;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;  // Pending requests and batching thread
+};
+
+}  // namespace vart
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "vart_device.hpp"
+#include "vart_overlay.hpp"
+
+namespace vart {
+
+/**
+ * @struct HostOverlayConfig
+ * @brief Configuration of the host overlay engine.
+ *
+ * @var HostOverlayConfig::band_height
+ *   Number of frame rows per band. 0 selects a height such that the rows of a
+ * band fit in the L2 cache.
+ * @var HostOverlayConfig::num_threads
+ *   Number of threads the bands are split across. 0 uses one thread per
+ * available core.
+ * @var HostOverlayConfig::glyph_cache_bytes
+ *   Maximum size of the glyph atlases cached across frames. Atlases are
+ * keyed by font, scale and thickness.
+ */
+struct HostOverlayConfig {
+  uint32_t band_height = 0;
+  uint32_t num_threads = 0;
+  size_t glyph_cache_bytes = 4 * 1024 * 1024;
+};
+
+/**
+ * @class HostOverlay
+ * @brief Creates Overlay instances drawing with a batched host engine.
+ *
+ * The per-shape implementation makes one pass over the frame memory for each
+ * box, line, circle and text label. The host engine instead:
+ * - clips the shapes of OverlayShapeInfo and sorts their spans by row band;
+ * - draws each band in one pass, directly on the NV12 or BGR planes, blending
+ * with AVX2 or AVX-512 when available;
+ * - renders text from glyph atlases cached across frames, instead of
+ * rasterizing the font for each label;
+ * - skips the bands, and the columns within a band, that no shape covers, so
+ * that only the dirty rectangles of the frame are touched.
+ *
+ * Bands are split across a thread pool. The output is the same as that of the
+ * per-shape implementation, up to the rounding of blended and anti-aliased
+ * pixels.
+ *
+ * The engine supports NV12 and BGR frames. Frames of any other format are
+ * drawn by the per-shape implementation, so the returned module accepts every
+ * format the per-shape Overlay accepts; a warning is logged the first time a
+ * frame of an unsupported format is drawn.
+ */
+class HostOverlay {
+ public:
+  /**
+   * @brief Creates an Overlay module backed by the host engine.
+   *
+   * The returned module is used as any other Overlay, with
+   * Overlay::draw_overlay(). NV12 and BGR frames are drawn by the host engine
+   * and other formats by the per-shape implementation.
+   *
+   * @param device Handle to the device.
+   * @param config Engine configuration.
+   * @return std::shared_ptr<Overlay> The created module.
+   */
+  static std::shared_ptr<Overlay> create(std::shared_ptr<Device> device,
+                                         const HostOverlayConfig& config = {});
+};
+
+}  // namespace vart
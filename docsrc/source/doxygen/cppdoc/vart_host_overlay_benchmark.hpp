@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "vart_host_overlay.hpp"
+
+namespace vart {
+
+/**
+ * @struct OverlayBenchmarkResult
+ * @brief Comparison of the host overlay engine with the per-shape overlay for
+ * one frame configuration and number of shapes.
+ *
+ * @var OverlayBenchmarkResult::frame_info
+ *   Frame resolution and format.
+ * @var OverlayBenchmarkResult::num_boxes
+ *   Number of labelled boxes drawn on each frame.
+ * @var OverlayBenchmarkResult::per_shape_fps
+ *   Frames per second of the per-shape Overlay implementation.
+ * @var OverlayBenchmarkResult::engine_fps
+ *   Frames per second of the HostOverlay engine.
+ * @var OverlayBenchmarkResult::touched_ratio
+ *   Fraction of the frame bytes read or written by the engine.
+ */
+struct OverlayBenchmarkResult {
+  VideoInfo frame_info;
+  uint32_t num_boxes;
+  double per_shape_fps;
+  double engine_fps;
+  double touched_ratio;
+};
+
+/**
+ * @class OverlayBenchmark
+ * @brief Compares the host overlay engine with the per-shape overlay.
+ *
+ * Boxes and labels are placed from a fixed seed, so that runs are
+ * reproducible.
+ */
+class OverlayBenchmark {
+ public:
+  /**
+   * @brief Runs the overlay benchmark.
+   *
+   * @param frames Frame configurations to measure, for example 1080p NV12 and
+   * BGR frames.
+   * @param box_counts Numbers of labelled boxes per frame.
+   * @param device Handle to the device.
+   * @param iterations Number of measured frames per configuration.
+   * @return One OverlayBenchmarkResult per frame configuration and number of
+   * boxes.
+   */
+  static std::vector<OverlayBenchmarkResult> run(
+      const std::vector<VideoInfo>& frames,
+      const std::vector<uint32_t>& box_counts,
+      std::shared_ptr<Device> device,
+      uint32_t iterations = 100);
+
+  /**
+   * @brief Prints results as a table.
+   *
+   * @param results Results returned by run().
+   * @param os Output stream. Defaults to std::cout.
+   */
+  static void print_report(const std::vector<OverlayBenchmarkResult>& results,
+                           std::ostream& os = std::cout);
+};
+
+}  // namespace vart
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "vart_data_converter.hpp"
+#include "vart_device.hpp"
+#include "vart_npu_tensor.hpp"
+#include "vart_preprocess.hpp"
+#include "vart_runner_factory.hpp"
+
+namespace vart {
+
+/**
+ * @struct HostPreProcessConfig
+ * @brief Configuration of the host pre-processing implementation.
+ *
+ * @var HostPreProcessConfig::output_info
+ *   Metadata of the runner input tensor the pre-processing writes to, as
+ * returned by Runner::get_tensors_info(). Either the TensorType::CPU or the
+ * TensorType::HW information can be used; with the HW information, the output
+ * can be passed to the runner with zero copy.
+ * @var HostPreProcessConfig::quant_params
+ *   Quantization parameters of the runner input tensor, as returned by
+ * Runner::get_quant_parameters(). Used when output_info has an integer data
+ * type.
+ * @var HostPreProcessConfig::num_threads
+ *   Number of threads the output tiles are split across. 0 uses one thread
+ * per available core.
+ * @var HostPreProcessConfig::tile_height
+ *   Number of output rows per tile. 0 selects a height such that the input
+ * and output rows of a tile fit in the L2 cache.
+ */
+struct HostPreProcessConfig {
+  NpuTensorInfo output_info;
+  QuantParameters quant_params = {1.0, 0, RoundingMode::ROUND_TO_NEAREST_EVEN};
+  uint32_t num_threads = 0;
+  uint32_t tile_height = 0;
+};
+
+/**
+ * @class HostPreProcess
+ * @brief Creates PreProcess instances running entirely on the host.
+ *
+ * The host implementation is the fallback for platforms without the
+ * image-processing PL accelerator. It performs the crop, resize, colour
+ * conversion, mean/scale normalization and quantization described by
+ * PreProcessOp and PreProcessInfo in a single pass over each output tile:
+ * every output pixel is computed from the input frame and written directly in
+ * the data type and memory layout of the runner input tensor, without
+ * intermediate images.
+ *
+ * Output tiles are split across a thread pool. Inner loops use AVX2 or
+ * AVX-512 when available, selected at runtime with DataConverter::get_isa(),
+ * with a scalar fallback.
+ *
+ * Supported input formats are NV12, BGR and RGB.
+ *
+ * Relation to the implementations selected with PreProcessImplType: the
+ * hardware-accelerated implementation,
+ * PreProcessImplType::IMAGE_PROCESSING_HLS, remains the preferred choice when
+ * the PL accelerator is present. The
+ * existing software implementation runs each operation as a separate pass over
+ * the whole frame; HostPreProcess replaces it on platforms without the
+ * accelerator, with the same JSON configuration and PreProcessInfo. Its
+ * outputs match those of the software implementation within one quantization
+ * step, because the fused pass does not round the intermediate resized and
+ * colour-converted images to 8 bits. PreProcessBenchmark measures both.
+ */
+class HostPreProcess {
+ public:
+  /**
+   * @brief Creates a PreProcess module backed by the host implementation.
+   *
+   * The returned module is used as any other PreProcess, including
+   * PreProcess::set_preprocess_info() and PreProcess::process().
+   *
+   * @param json_data Pre-processing configuration, in the same JSON format as
+   * for the other PreProcess implementations.
+   * @param device Handle to the device. Only used to allocate output frames.
+   * @param config Host implementation configuration.
+   * @return std::shared_ptr<PreProcess> The created module.
+   */
+  static std::shared_ptr<PreProcess> create(
+      std::string& json_data,
+      std::shared_ptr<Device> device,
+      const HostPreProcessConfig& config);
+};
+
+}  // namespace vart
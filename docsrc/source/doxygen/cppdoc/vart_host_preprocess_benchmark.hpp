@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "vart_host_preprocess.hpp"
+
+namespace vart {
+
+/**
+ * @struct PreProcessBenchmarkResult
+ * @brief Throughput of the host pre-processing for one input configuration.
+ *
+ * @var PreProcessBenchmarkResult::input_info
+ *   Input frame resolution and format.
+ * @var PreProcessBenchmarkResult::fused_fps
+ *   Frames per second of the fused single-pass HostPreProcess.
+ * @var PreProcessBenchmarkResult::separate_fps
+ *   Frames per second of the same operations run as separate passes over the
+ * whole frame (resize, colour conversion, normalization, quantization).
+ */
+struct PreProcessBenchmarkResult {
+  VideoInfo input_info;
+  double fused_fps;
+  double separate_fps;
+};
+
+/**
+ * @class PreProcessBenchmark
+ * @brief Compares the fused host pre-processing with a chain of separate
+ * passes.
+ */
+class PreProcessBenchmark {
+ public:
+  /**
+   * @brief Runs the pre-processing benchmark.
+   *
+   * @param inputs Input frame configurations to measure, for example 1080p and
+   * 4K NV12 and BGR frames.
+   * @param config Host pre-processing configuration, including the runner
+   * input tensor to write.
+   * @param iterations Number of measured frames per configuration.
+   * @return One PreProcessBenchmarkResult per input configuration.
+   */
+  static std::vector<PreProcessBenchmarkResult> run(
+      const std::vector<VideoInfo>& inputs,
+      const HostPreProcessConfig& config,
+      uint32_t iterations = 100);
+
+  /**
+   * @brief Prints results as a table.
+   *
+   * @param results Results returned by run().
+   * @param os Output stream. Defaults to std::cout.
+   */
+  static void print_report(
+      const std::vector<PreProcessBenchmarkResult>& results,
+      std::ostream& os = std::cout);
+};
+
+}  // namespace vart
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "vart_data_converter.hpp"
+#include "vart_npu_tensor.hpp"
+#include "vart_runner_factory.hpp"
+
+namespace vart {
+
+/**
+ * @struct TranscodeOptions
+ * @brief Options used to build a LayoutTranscoder plan.
+ *
+ * @var TranscodeOptions::src_params
+ *   Quantization parameters of the source tensor. Used when the source data
+ * type is an integer type and differs from the destination data type.
+ * @var TranscodeOptions::dst_params
+ *   Quantization parameters of the destination tensor. Used when the
+ * destination data type is an integer type and differs from the source data
+ * type.
+ * @var TranscodeOptions::num_threads
+ *   Number of threads the plan splits its blocks across. 1 executes on the
+ * calling thread only. 0 uses one thread per available core.
+ * @var TranscodeOptions::block_size_bytes
+ *   Target size of the source and destination working set of one block. 0
+ * selects a size fitting in the L2 cache of the host.
+ */
+struct TranscodeOptions {
+  QuantParameters src_params = {1.0, 0, RoundingMode::ROUND_TO_NEAREST_EVEN};
+  QuantParameters dst_params = {1.0, 0, RoundingMode::ROUND_TO_NEAREST_EVEN};
+  uint32_t num_threads = 1;
+  size_t block_size_bytes = 0;
+};
+
+/**
+ * @class LayoutTranscoder
+ * @brief Reusable plan converting tensor data between two memory layouts.
+ *
+ * A LayoutTranscoder is built once from a source and a destination
+ * NpuTensorInfo, typically the TensorType::CPU and TensorType::HW information
+ * of the same tensor returned by Runner::get_tensors_info(). The plan
+ * precomputes the dimension permutation, the channel grouping and padding of
+ * layouts such as NHWC4, NC4HW4, NC8HW8, HCWNC4 and HCWNC8, the strides of both
+ * tensors and a cache-blocked traversal order. It can then be executed on any
+ * number of frames.
+ *
+ * When the source and destination data types differ, the data type
+ * conversion of DataConverter is fused into the layout transform, so that a
+ * transpose+quantize or transpose+dequantize reads and writes the data only
+ * once.
+ *
+ * Inner loops use the instruction set selected by DataConverter::get_isa().
+ * Padding elements of the destination (extra channels of a channel group, or
+ * stride padding) are set to the zero point of the destination.
+ */
+class LayoutTranscoder {
+ public:
+  /**
+   * @brief Builds a transcoding plan.
+   *
+   * @param src_info Metadata of the source tensor.
+   * @param dst_info Metadata of the destination tensor. Must describe the same
+   * logical shape as src_info.
+   * @param options Plan options.
+   * @return std::unique_ptr<LayoutTranscoder> The plan, or nullptr if the
+   * layouts or shapes are not compatible.
+   */
+  static std::unique_ptr<LayoutTranscoder> create(
+      const NpuTensorInfo& src_info,
+      const NpuTensorInfo& dst_info,
+      const TranscodeOptions& options = {});
+
+  ~LayoutTranscoder();
+
+  LayoutTranscoder(const LayoutTranscoder& other) = delete;
+  LayoutTranscoder& operator=(const LayoutTranscoder& other) = delete;
+
+  /**
+   * @brief Executes the plan on raw buffers.
+   *
+   * The plan can be executed concurrently from several threads on different
+   * buffers.
+   *
+   * @param src Pointer to the source data, laid out as described by src_info.
+   * @param dst Pointer to the destination data, laid out as described by
+   * dst_info. Must not overlap src.
+   * @param batch_size Number of batch entries to convert. 0 converts the full
+   * batch dimension of the tensor information.
+   * @return StatusCode The status of the conversion.
+   */
+  StatusCode execute(const void* src, void* dst, size_t batch_size = 0) const;
+
+  /**
+   * @brief Executes the plan on tensors.
+   *
+   * Both tensors must be accessible from the host and match the tensor
+   * information the plan was built with.
+   *
+   * @param src Source tensor.
+   * @param dst Destination tensor.
+   * @return StatusCode::SUCCESS, or StatusCode::INVALID_INPUT if a tensor does
+   * not match the plan.
+   */
+  StatusCode execute(const NpuTensor& src, NpuTensor& dst) const;
+
+  /**
+   * @brief Returns the source tensor metadata of the plan.
+   *
+   * @return A constant reference to the source NpuTensorInfo.
+   */
+  const NpuTensorInfo& get_src_info() const;
+
+  /**
+   * @brief Returns the destination tensor metadata of the plan.
+   *
+   * @return A constant reference to the destination NpuTensorInfo.
+   */
+  const NpuTensorInfo& get_dst_info() const;
+
+ private:
+  LayoutTranscoder();
+
+  struct Plan;
+  std::unique_ptr<Plan> plan_;  // Precomputed traversal of the transform
+};
+
+}  // namespace vart
@@ -0,0 +1,305 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+#include "vart_logger.hpp"
+
+namespace vart {
+
+/**
+ * @def VART_LOG_COMPILE_LEVEL
+ * @brief Most verbose log level compiled into the asynchronous log macros.
+ *
+ * Numeric value of a LogLevel: 1 for LOG_LEVEL_ERROR up to 5 for
+ * LOG_LEVEL_DEBUG. Calls to VART_LOG_*_ASYNC macros of a more verbose level
+ * compile to nothing, including the evaluation of their arguments. Defaults
+ * to 4 (LOG_LEVEL_INFO); define it to 5 before including this header to keep
+ * debug logs.
+ */
+#ifndef VART_LOG_COMPILE_LEVEL
+#define VART_LOG_COMPILE_LEVEL 4
+#endif
+
+// Static record shared by all calls of one log statement. Its address is the
+// format-string ID stored in the ring buffers.
+#define VART_LOG_ASYNC_IMPL(lvl, num, x, fmt, ...)                           \
+  do {                                                                       \
+    if constexpr (VART_LOG_COMPILE_LEVEL >= num) {                           \
+      static const vart::LogSite vart_log_site = {lvl, __FILE__, __func__,   \
+                                                  __LINE__, fmt};            \
+      vart::AsyncLogger::get_instance().log(x, &vart_log_site,               \
+                                            ##__VA_ARGS__);                  \
+    }                                                                        \
+  } while (0)
+
+#define VART_LOG_ERR_ASYNC(x, fmt, ...)                                      \
+  VART_LOG_ASYNC_IMPL(vart::LogLevel::LOG_LEVEL_ERROR, 1, x, fmt,            \
+                      ##__VA_ARGS__)
+#define VART_LOG_WARN_ASYNC(x, fmt, ...)                                     \
+  VART_LOG_ASYNC_IMPL(vart::LogLevel::LOG_LEVEL_WARNING, 2, x, fmt,          \
+                      ##__VA_ARGS__)
+#define VART_LOG_FIXME_ASYNC(x, fmt, ...)                                    \
+  VART_LOG_ASYNC_IMPL(vart::LogLevel::LOG_LEVEL_FIXME, 3, x, fmt,            \
+                      ##__VA_ARGS__)
+#define VART_LOG_INFO_ASYNC(x, fmt, ...)                                     \
+  VART_LOG_ASYNC_IMPL(vart::LogLevel::LOG_LEVEL_INFO, 4, x, fmt,             \
+                      ##__VA_ARGS__)
+#define VART_LOG_DEBUG_ASYNC(x, fmt, ...)                                    \
+  VART_LOG_ASYNC_IMPL(vart::LogLevel::LOG_LEVEL_DEBUG, 5, x, fmt,            \
+                      ##__VA_ARGS__)
+
+/**
+ * @struct LogSite
+ * @brief Static description of one asynchronous log statement.
+ *
+ * Created once per statement by the VART_LOG_*_ASYNC macros. The address of
+ * the LogSite identifies the statement in the ring buffers, so that the file
+ * name, function name and format string are never copied per call.
+ *
+ * @var LogSite::level
+ *   Level of the statement.
+ * @var LogSite::filename
+ *   Source file of the statement.
+ * @var LogSite::func
+ *   Function containing the statement.
+ * @var LogSite::line
+ *   Source line of the statement.
+ * @var LogSite::fmt
+ *   printf-style format string.
+ */
+struct LogSite {
+  LogLevel level;
+  const char* filename;
+  const char* func;
+  uint32_t line;
+  const char* fmt;
+};
+
+namespace detail {
+
+// Type tag preceding each argument in a record, read by the drainer thread.
+enum class AsyncLogArgType : uint8_t { INT64, UINT64, DOUBLE, POINTER, STRING };
+
+template <typename T>
+constexpr bool is_async_log_string_v =
+    std::is_same_v<std::decay_t<T>, const char*> ||
+    std::is_same_v<std::decay_t<T>, char*>;
+
+// Number of record bytes used by one argument.
+template <typename T>
+inline size_t async_log_arg_size(const T& arg) {
+  if constexpr (is_async_log_string_v<T>) {
+    const char* str = arg;
+    return 1 + sizeof(uint32_t) + (str ? std::strlen(str) : 0);
+  } else {
+    static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+                      std::is_pointer_v<std::decay_t<T>>,
+                  "async log arguments must be integers, enumerations, "
+                  "floating-point values, pointers or C strings");
+    return 1 + sizeof(uint64_t);
+  }
+}
+
+// Writes one argument at p and returns the end of the written bytes.
+template <typename T>
+inline uint8_t* async_log_write_arg(uint8_t* p, const T& arg) {
+  if constexpr (is_async_log_string_v<T>) {
+    const char* str = arg;
+    const uint32_t len = str ? static_cast<uint32_t>(std::strlen(str)) : 0;
+    *p++ = static_cast<uint8_t>(AsyncLogArgType::STRING);
+    std::memcpy(p, &len, sizeof(len));
+    p += sizeof(len);
+    if (len != 0) {
+      std::memcpy(p, str, len);
+    }
+    return p + len;
+  } else {
+    AsyncLogArgType type;
+    uint64_t bits;
+    if constexpr (std::is_floating_point_v<T>) {
+      const double value = static_cast<double>(arg);
+      type = AsyncLogArgType::DOUBLE;
+      std::memcpy(&bits, &value, sizeof(bits));
+    } else if constexpr (std::is_pointer_v<std::decay_t<T>>) {
+      type = AsyncLogArgType::POINTER;
+      bits = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(arg));
+    } else if constexpr (std::is_enum_v<T>) {
+      type = AsyncLogArgType::INT64;
+      bits = static_cast<uint64_t>(static_cast<int64_t>(arg));
+    } else if constexpr (std::is_signed_v<T>) {
+      type = AsyncLogArgType::INT64;
+      bits = static_cast<uint64_t>(static_cast<int64_t>(arg));
+    } else {
+      type = AsyncLogArgType::UINT64;
+      bits = static_cast<uint64_t>(arg);
+    }
+    *p++ = static_cast<uint8_t>(type);
+    std::memcpy(p, &bits, sizeof(bits));
+    return p + sizeof(bits);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @struct AsyncLogConfig
+ * @brief Configuration of the asynchronous logging backend.
+ *
+ * @var AsyncLogConfig::ring_size_bytes
+ *   Size of the ring buffer of each logging thread.
+ * @var AsyncLogConfig::drain_interval_ms
+ *   Maximum time in milliseconds between two passes of the drainer thread.
+ * The drainer also wakes up when a ring is half full.
+ */
+struct AsyncLogConfig {
+  size_t ring_size_bytes = 64 * 1024;
+  uint32_t drain_interval_ms = 10;
+};
+
+/**
+ * @struct AsyncLogStats
+ * @brief Counters of the asynchronous logging backend.
+ *
+ * @var AsyncLogStats::records_written
+ *   Number of records written to the ring buffers.
+ * @var AsyncLogStats::records_dropped
+ *   Number of records dropped because the ring buffer of the calling thread
+ * was full.
+ * @var AsyncLogStats::records_formatted
+ *   Number of records formatted and written by the drainer thread.
+ */
+struct AsyncLogStats {
+  uint64_t records_written;
+  uint64_t records_dropped;
+  uint64_t records_formatted;
+};
+
+/**
+ * @class AsyncLogger
+ * @brief Lock-free, asynchronous logging backend of vart::Logger.
+ *
+ * Logger::vart_logger_log_obj() formats each message on the calling thread
+ * under a global mutex. AsyncLogger instead appends a binary record, made of
+ * the LogSite address, a timestamp and the raw arguments, to a single-producer
+ * ring buffer owned by the calling thread. A background drainer thread formats
+ * the records and writes them to the log output configured in Logger, in
+ * timestamp order.
+ *
+ * Logging never blocks the caller: when the ring of the calling thread is full,
+ * the record is dropped and counted in AsyncLogStats::records_dropped.
+ *
+ * Arguments must be integers, enumerations, floating-point values, pointers or
+ * C strings; other types are rejected at compile time.
+ * C strings are copied into the record, since they may not outlive the call.
+ * The runtime log level registered through Logger::mod_register() is checked
+ * before the record is written.
+ */
+class AsyncLogger {
+ public:
+  /**
+   * @brief Returns the process-wide asynchronous logger.
+   *
+   * @return A reference to the AsyncLogger instance.
+   */
+  static AsyncLogger& get_instance();
+
+  /**
+   * @brief Starts the drainer thread.
+   *
+   * Until start() is called, records are formatted synchronously through
+   * Logger::vart_logger_log_obj().
+   *
+   * @param config Backend configuration.
+   */
+  void start(const AsyncLogConfig& config = {});
+
+  /**
+   * @brief Formats all pending records and stops the drainer thread.
+   *
+   * Called automatically at process exit.
+   */
+  void stop();
+
+  /**
+   * @brief Writes a record to the ring buffer of the calling thread.
+   *
+   * Use the VART_LOG_*_ASYNC macros instead of calling this method directly.
+   *
+   * @param ctx Context returned by Logger::mod_register().
+   * @param site Static description of the log statement.
+   * @param args Arguments matching the format string of site.
+   */
+  template <typename... Args>
+  void log(const std::shared_ptr<struct log_context>& ctx,
+           const LogSite* site,
+           const Args&... args);
+
+  /**
+   * @brief Returns the backend counters.
+   *
+   * @return AsyncLogStats A snapshot of the counters.
+   */
+  AsyncLogStats get_stats() const;
+
+ private:
+  AsyncLogger();
+  ~AsyncLogger();
+  AsyncLogger(const AsyncLogger&) = delete;
+  void operator=(const AsyncLogger&) = delete;
+
+  // Checks the runtime level registered for ctx.
+  bool is_enabled(const std::shared_ptr<struct log_context>& ctx,
+                  LogLevel level) const;
+
+  // Reserves a record of payload_size argument bytes in the ring of the
+  // calling thread and writes its header. Returns a pointer to the payload, or
+  // nullptr if the ring is full and the record is dropped. Before start(), the
+  // record is reserved in a thread-local scratch buffer instead.
+  uint8_t* reserve(const LogSite* site, uint32_t num_args, size_t payload_size);
+
+  // Publishes the record reserved last by the calling thread, or formats it
+  // synchronously before start().
+  void commit();
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;  // Per-thread rings and drainer thread
+};
+
+template <typename... Args>
+inline void AsyncLogger::log(const std::shared_ptr<struct log_context>& ctx,
+                             const LogSite* site,
+                             const Args&... args) {
+  if (!is_enabled(ctx, site->level)) {
+    return;
+  }
+  const size_t payload_size =
+      (size_t{0} + ... + detail::async_log_arg_size(args));
+  uint8_t* p = reserve(site, sizeof...(Args), payload_size);
+  if (p == nullptr) {
+    return;  // Ring full, counted in records_dropped
+  }
+  ((p = detail::async_log_write_arg(p, args)), ...);
+  commit();
+}
+
+}  // namespace vart
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "vart_runner_factory.hpp"
+
+namespace vart {
+
+/**
+ * @struct LookupBenchmarkResult
+ * @brief Cost of one tensor metadata lookup method.
+ *
+ * @var LookupBenchmarkResult::method
+ *   Name of the measured method, for example "get_tensor_info_by_name" or
+ * "get_tensor_info_by_handle".
+ * @var LookupBenchmarkResult::ns_per_call
+ *   Mean time per call in nanoseconds.
+ */
+struct LookupBenchmarkResult {
+  std::string method;
+  double ns_per_call;
+};
+
+/**
+ * @class LookupBenchmark
+ * @brief Compares name-based and handle-based tensor metadata lookups.
+ *
+ * Measures get_tensor_info_by_name() and get_quant_parameters() with tensor
+ * names against get_tensor_info_by_handle() and
+ * get_quant_parameters_by_handle(), for every tensor of the runner.
+ */
+class LookupBenchmark {
+ public:
+  /**
+   * @brief Runs the lookup benchmark.
+   *
+   * @param runner Runner whose tensors are looked up.
+   * @param iterations Number of lookups per tensor and method.
+   * @return One LookupBenchmarkResult per method.
+   */
+  static std::vector<LookupBenchmarkResult> run(const Runner& runner,
+                                                uint32_t iterations = 1000000);
+
+  /**
+   * @brief Prints results as a table.
+   *
+   * @param results Results returned by run().
+   * @param os Output stream. Defaults to std::cout.
+   */
+  static void print_report(const std::vector<LookupBenchmarkResult>& results,
+                           std::ostream& os = std::cout);
+};
+
+}  // namespace vart
@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <any>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "vart_runner_factory.hpp"
+#include "vart_stats.hpp"
+
+namespace vart {
+
+/**
+ * @enum ModelLoadSource
+ * @brief Enumerates where the prepared model of a runner came from.
+ *
+ * - COLD: The model was parsed and prepared from model_path.
+ * - WARM_IN_PROCESS: The model was shared with a runner already created in
+ * this process.
+ * - WARM_SNAPSHOT: The model was mapped from an on-disk snapshot, skipping
+ * parsing.
+ */
+enum class ModelLoadSource { COLD, WARM_IN_PROCESS, WARM_SNAPSHOT };
+
+/**
+ * @struct ModelCacheConfig
+ * @brief Configuration of the process-wide ModelCache.
+ *
+ * @var ModelCacheConfig::snapshot_dir
+ *   Directory holding model snapshots. Empty disables snapshots. The directory
+ * must be owned by the user running the process, or by root, and must not be
+ * writable by other users (for example mode 0755 or 0750). Snapshots are not
+ * loaded from a directory that does not meet these conditions, nor from files
+ * owned by another user.
+ * @var ModelCacheConfig::write_snapshots
+ *   If true, a snapshot is written to snapshot_dir after each cold load, so
+ * that other processes can start warm.
+ * @var ModelCacheConfig::verify_checksum
+ *   If true, the checksum of the snapshot payload is verified before a mapped
+ * snapshot is used. Verification reads the whole snapshot once; disable it
+ * only when snapshots come from a trusted, local source.
+ * @var ModelCacheConfig::max_models
+ *   Maximum number of prepared models kept alive by the cache when no runner
+ * uses them. Models in use by a runner are never evicted. 0 keeps no unused
+ * model.
+ */
+struct ModelCacheConfig {
+  std::string snapshot_dir;
+  bool write_snapshots = false;
+  bool verify_checksum = true;
+  uint32_t max_models = 8;
+};
+
+/**
+ * @struct ModelCacheStats
+ * @brief Counters and runner creation times of the ModelCache.
+ *
+ * @var ModelCacheStats::cold_loads
+ *   Number of runners created with ModelLoadSource::COLD.
+ * @var ModelCacheStats::in_process_hits
+ *   Number of runners created with ModelLoadSource::WARM_IN_PROCESS.
+ * @var ModelCacheStats::snapshot_hits
+ *   Number of runners created with ModelLoadSource::WARM_SNAPSHOT.
+ * @var ModelCacheStats::snapshot_rejects
+ *   Number of snapshots ignored because their format version, content hash,
+ * options, size or payload checksum did not match, or because of their
+ * ownership or permissions.
+ * @var ModelCacheStats::cached_models
+ *   Number of prepared models currently held by the cache.
+ * @var ModelCacheStats::cold_create_us
+ *   Runner creation time for cold loads.
+ * @var ModelCacheStats::in_process_create_us
+ *   Runner creation time for in-process hits.
+ * @var ModelCacheStats::snapshot_create_us
+ *   Runner creation time for snapshot hits.
+ */
+struct ModelCacheStats {
+  uint64_t cold_loads;
+  uint64_t in_process_hits;
+  uint64_t snapshot_hits;
+  uint64_t snapshot_rejects;
+  uint32_t cached_models;
+  LatencySummary cold_create_us;
+  LatencySummary in_process_create_us;
+  LatencySummary snapshot_create_us;
+};
+
+/**
+ * @class ModelCache
+ * @brief Process-wide cache of prepared models used by RunnerFactory.
+ *
+ * The parsed model, the NpuTensorInfo tables and the QuantParameters tables
+ * are immutable once a model is prepared. The cache shares them between all
+ * the runners created from the same model, keyed by model path, content hash
+ * of the model file and the options that affect preparation. Each runner
+ * still owns its hardware context and buffers.
+ *
+ * A snapshot is a versioned serialization of a prepared model. It is mapped
+ * read-only with mmap(), so a fresh process can create a runner without
+ * parsing the model, and processes on the same node share the snapshot pages.
+ * Its header records the format version, the content hash of the model file,
+ * a hash of the options, the payload size and a checksum of the payload. A
+ * snapshot whose file size does not match the header, or whose checksum does
+ * not match its payload, is rejected and the model is loaded cold, so a
+ * truncated or corrupted file is never used. Snapshots are written to a
+ * temporary file in snapshot_dir and renamed into place once complete, so
+ * readers never map a partially written snapshot.
+ *
+ * RunnerFactory::create_runner() goes through the cache unless the
+ * "use_model_cache" option is false. The cache is thread-safe; concurrent
+ * creations of the same model prepare it once.
+ */
+class ModelCache {
+ public:
+  /**
+   * @brief Returns the process-wide cache.
+   *
+   * @return ModelCache& The singleton instance.
+   */
+  static ModelCache& get_instance();
+
+  ModelCache(const ModelCache& other) = delete;
+  ModelCache& operator=(const ModelCache& other) = delete;
+
+  /**
+   * @brief Sets the cache configuration.
+   *
+   * The configuration applies to the runner creations, preloads and snapshot
+   * writes that start after configure() returns. Existing runners keep their
+   * prepared models, and cached models stay in the cache, whatever their
+   * origin. If max_models is lowered, the unused models beyond the new limit
+   * are evicted immediately.
+   *
+   * @param config Cache configuration.
+   */
+  void configure(const ModelCacheConfig& config);
+
+  /**
+   * @brief Prepares a model ahead of time, so that later runner creations are
+   * warm.
+   *
+   * @param device The type of device the model is prepared for.
+   * @param model_path The file system path to the model.
+   * @param options Runner options, as passed to
+   * RunnerFactory::create_runner().
+   * @return ModelLoadSource Where the prepared model came from.
+   */
+  ModelLoadSource preload(
+      RunnerType device,
+      const std::string& model_path,
+      const std::unordered_map<std::string, std::any>& options = {});
+
+  /**
+   * @brief Writes the snapshot of a model.
+   *
+   * The model is prepared first if it is not cached.
+   *
+   * @param device The type of device the model is prepared for.
+   * @param model_path The file system path to the model.
+   * @param snapshot_path Path of the snapshot file to write.
+   * @param options Runner options, as passed to
+   * RunnerFactory::create_runner().
+   * @return StatusCode SUCCESS, or FAILURE if the snapshot cannot be written.
+   */
+  StatusCode save_snapshot(
+      RunnerType device,
+      const std::string& model_path,
+      const std::string& snapshot_path,
+      const std::unordered_map<std::string, std::any>& options = {});
+
+  /**
+   * @brief Returns where the prepared model of a runner came from.
+   *
+   * @param runner Runner created by RunnerFactory::create_runner().
+   * @return ModelLoadSource Load source of the runner.
+   */
+  ModelLoadSource get_load_source(const Runner& runner) const;
+
+  /**
+   * @brief Drops the unused prepared models.
+   *
+   * Models in use by a runner stay cached until their last runner is
+   * destroyed.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the cache counters and creation times.
+   *
+   * @return ModelCacheStats A snapshot of the counters.
+   */
+  ModelCacheStats get_stats() const;
+
+ private:
+  ModelCache();
+  ~ModelCache();
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;  // Prepared models keyed by path, hash, options
+};
+
+}  // namespace vart
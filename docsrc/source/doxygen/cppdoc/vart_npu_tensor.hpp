@@ -189,11 +189,21 @@ struct NpuTensorInfo {
  * data buffers. It acts as a lightweight wrapper around buffers supplied by the
  * user.
  *
- * @note: This class does not take ownership of the buffer memory.
- * The user is responsible for managing the buffer's lifecycle.
+ * @note: Unless constructed with a BufferReleaser, this class does not take
+ * ownership of the buffer memory. The user is responsible for managing the
+ * buffer's lifecycle.
  */
 class NpuTensor {
  public:
+  /**
+   * @brief Alias for a function that releases the buffer of an owning tensor.
+   *
+   * The function is called with the buffer pointer and the context passed to
+   * the owning constructor when the owning tensor is destroyed. A plain
+   * function pointer keeps NpuTensor small and its moves allocation-free.
+   */
+  using BufferReleaser = void (*)(void* buffer, void* context);
+
   /**
    * @brief Construct a NpuTensor from a user-supplied buffer.
    *
@@ -217,6 +227,35 @@ class NpuTensor {
             const MemoryType& mem_type,
             const TensorType& type = TensorType::CPU);
 
+  /**
+   * @brief Construct a NpuTensor that owns its buffer.
+   *
+   * Same as the non-owning constructor, except that releaser is called exactly
+   * once with buffer when the tensor is destroyed. Ownership follows the tensor
+   * on move; a moved-from tensor does not release anything. TensorPool uses
+   * this constructor to return buffers to the pool.
+   *
+   * @param info      Tensor metadata (NpuTensorInfo).
+   * @param buffer    Pointer to the buffer containing the tensor data.
+   * @param mem_type  Specifies whether the buffer is in host or device memory
+   * (HOST or DEVICE).
+   * @param type      Indicates the tensor type (CPU or HW).
+   * @param releaser  Function releasing buffer.
+   * @param context   Opaque pointer passed to releaser, for example the pool
+   * owning buffer.
+   */
+  NpuTensor(const NpuTensorInfo& info,
+            void* buffer,
+            const MemoryType& mem_type,
+            const TensorType& type,
+            BufferReleaser releaser,
+            void* context);
+
+  /**
+   * @brief Destroys the tensor, releasing the buffer if the tensor owns it.
+   */
+  ~NpuTensor();
+
   NpuTensor() = delete;                        // Disable default constructor
   NpuTensor(const NpuTensor& other) = delete;  // Disable copy constructor
   NpuTensor& operator=(const NpuTensor& other) =
@@ -235,6 +274,13 @@ class NpuTensor {
    * retrieve the buffer.
    * @return void*   Pointer to the buffer, or nullptr if no buffer is available
    * for the requested memory type.
+   *
+   * @note For a MemoryType::DEVICE tensor, get_buffer(MemoryType::DEVICE)
+   * returns the wrapped device buffer (an `xrt::bo` pointer) and
+   * get_buffer(MemoryType::HOST) returns the host mapping of that same device
+   * buffer, so the caller can fill or read the data in place without a copy.
+   * The mapping is the one of the device buffer object itself; NpuTensor does
+   * not create or hold any mapping state.
    */
   void* get_buffer(MemoryType mem_type) const;
 
@@ -271,11 +317,21 @@ class NpuTensor {
    */
   void print_info() const;
 
+  /**
+   * @brief Indicates whether the tensor owns its buffer.
+   *
+   * @return true if the tensor was constructed with a BufferReleaser and has
+   * not been moved from.
+   */
+  bool owns_buffer() const;
+
  private:
-  NpuTensorInfo info_;      // Tensor metadata
-  void* buffer_;            // Pointer to the buffer memory (host or device)
-  MemoryType memory_type_;  // Memory type (HOST or DEVICE)
-  TensorType type_;         // Tensor type (CPU or HW)
+  NpuTensorInfo info_;        // Tensor metadata
+  void* buffer_;              // Pointer to the buffer memory (host or device)
+  MemoryType memory_type_;    // Memory type (HOST or DEVICE)
+  TensorType type_;           // Tensor type (CPU or HW)
+  BufferReleaser releaser_;   // Releases buffer_ on destruction, or nullptr
+  void* releaser_context_;    // Context passed to releaser_
 };
 
 }  // namespace vart
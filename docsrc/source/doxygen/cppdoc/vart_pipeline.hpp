@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "vart_inferresult.hpp"
+#include "vart_metaconvert.hpp"
+#include "vart_overlay.hpp"
+#include "vart_postprocess.hpp"
+#include "vart_preprocess.hpp"
+#include "vart_runner_factory.hpp"
+#include "vart_stats.hpp"
+#include "vart_videoframe.hpp"
+
+namespace vart {
+
+/**
+ * @enum PipelineStage
+ * @brief Enumerates the stages of an InferencePipeline.
+ *
+ * - PRE_PROCESS:   PreProcess::process() of the input frame.
+ * - INFERENCE:     Runner::execute_async() and completion of the job.
+ * - POST_PROCESS:  PostProcess::process() of the output tensors.
+ * - OVERLAY:       MetaConvert::prepare_overlay_meta() and
+ * Overlay::draw_overlay(). Only present when an Overlay is configured.
+ */
+enum class PipelineStage { PRE_PROCESS, INFERENCE, POST_PROCESS, OVERLAY };
+
+/**
+ * @struct PipelineConfig
+ * @brief Configuration of an InferencePipeline.
+ *
+ * @var PipelineConfig::frames_in_flight
+ *   Maximum number of frames between submit() and the result callback. Also
+ * the number of preprocessed frames and output tensor sets allocated by the
+ * pipeline and recycled between frames.
+ * @var PipelineConfig::queue_depth
+ *   Capacity of the queue in front of each stage.
+ * @var PipelineConfig::timeout
+ *   Timeout in milliseconds of each inference job.
+ */
+struct PipelineConfig {
+  uint32_t frames_in_flight = 4;
+  uint32_t queue_depth = 2;
+  unsigned int timeout = 1000;
+};
+
+/**
+ * @struct PipelineStageStats
+ * @brief Latency and queueing statistics of one pipeline stage.
+ *
+ * @var PipelineStageStats::stage
+ *   Stage the statistics refer to.
+ * @var PipelineStageStats::frames
+ *   Number of frames processed by the stage.
+ * @var PipelineStageStats::latency
+ *   Time spent processing a frame in the stage.
+ * @var PipelineStageStats::queue_wait
+ *   Time a frame waited in the queue in front of the stage.
+ * @var PipelineStageStats::mean_queue_depth
+ *   Average number of frames waiting in the queue in front of the stage.
+ * @var PipelineStageStats::max_queue_depth
+ *   Largest number of frames waiting in the queue in front of the stage.
+ */
+struct PipelineStageStats {
+  PipelineStage stage;
+  uint64_t frames;
+  LatencySummary latency;
+  LatencySummary queue_wait;
+  double mean_queue_depth;
+  uint32_t max_queue_depth;
+};
+
+/**
+ * @class InferencePipeline
+ * @brief Runs PreProcess, Runner, PostProcess and Overlay as a pipeline.
+ *
+ * Each stage runs on its own thread and the stages are connected by bounded
+ * queues, so that the host pre- and post-processing of some frames overlaps
+ * with the NPU execution of others. The throughput of the pipeline approaches
+ * that of its slowest stage instead of the sum of all stages.
+ *
+ * submit() blocks while frames_in_flight frames are already in the pipeline,
+ * which propagates back-pressure to the frame source.
+ *
+ * The pipeline allocates the preprocessed VideoFrames and the output tensors
+ * once and recycles them between frames. When the runner is created with the
+ * "input_tensor_type" option set to "HW", the preprocessed frames are passed
+ * to the runner without a copy.
+ */
+class InferencePipeline {
+ public:
+  /**
+   * @brief Alias for the callback receiving the results of a frame.
+   *
+   * Invoked on the thread of the last stage, in submission order.
+   *
+   * @param status Status of the frame. Results are empty unless SUCCESS.
+   * @param frame The frame passed to submit(). When an Overlay is configured,
+   * the results are drawn on it.
+   * @param results Inference results of the frame.
+   * @param user_data The user data passed to submit().
+   */
+  using ResultCallback =
+      std::function<void(StatusCode status,
+                         std::shared_ptr<VideoFrame> frame,
+                         std::vector<std::shared_ptr<InferResult>>& results,
+                         void* user_data)>;
+
+  /**
+   * @brief Constructs a pipeline and starts its stage threads.
+   *
+   * @param preprocess Configured pre-processing module. Its output must match
+   * the input tensor of the runner.
+   * @param runner Runner executing the model.
+   * @param postprocess Post-processing module, already configured with
+   * PostProcess::set_config().
+   * @param callback Callback receiving the results of each frame.
+   * @param config Pipeline configuration.
+   * @param meta_convert Optional module converting results to overlay data.
+   * Required when overlay is set.
+   * @param overlay Optional module drawing the results on each frame.
+   */
+  InferencePipeline(std::shared_ptr<PreProcess> preprocess,
+                    std::shared_ptr<Runner> runner,
+                    std::shared_ptr<PostProcess> postprocess,
+                    ResultCallback callback,
+                    const PipelineConfig& config = {},
+                    std::shared_ptr<MetaConvert> meta_convert = nullptr,
+                    std::shared_ptr<Overlay> overlay = nullptr);
+
+  /**
+   * @brief Stops the pipeline, dropping frames that are still in flight.
+   */
+  ~InferencePipeline();
+
+  InferencePipeline(const InferencePipeline& other) = delete;
+  InferencePipeline& operator=(const InferencePipeline& other) = delete;
+
+  /**
+   * @brief Submits a frame to the pipeline.
+   *
+   * @param frame Input frame. The pipeline keeps a reference until the result
+   * callback of the frame returns.
+   * @param user_data User data passed to the result callback.
+   * @param timeout The maximum time in milliseconds to wait for room in the
+   * pipeline.
+   * @return StatusCode::SUCCESS, or StatusCode::TIMEOUT if frames_in_flight
+   * frames were still in the pipeline when the timeout expired.
+   */
+  StatusCode submit(std::shared_ptr<VideoFrame> frame,
+                    void* user_data = nullptr,
+                    unsigned int timeout = 1000);
+
+  /**
+   * @brief Waits until all submitted frames have been delivered to the
+   * callback.
+   *
+   * @param timeout The maximum time to wait in milliseconds.
+   * @return StatusCode::SUCCESS, or StatusCode::TIMEOUT.
+   */
+  StatusCode flush(unsigned int timeout);
+
+  /**
+   * @brief Returns the statistics of each stage.
+   *
+   * @return One PipelineStageStats per stage, in pipeline order.
+   */
+  std::vector<PipelineStageStats> get_stats() const;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;  // Stage threads, queues and buffer pools
+};
+
+}  // namespace vart
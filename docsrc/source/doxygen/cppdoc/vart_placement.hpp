@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "vart_device.hpp"
+
+namespace vart {
+
+/**
+ * @brief Memory bank index letting the PlacementPolicy choose the bank.
+ *
+ * Can be passed as the mbank_idx of Memory and VideoFrame, and as the ddr of
+ * NpuRunner::malloc_buffer().
+ */
+constexpr uint8_t PLACEMENT_AUTO_BANK = 0xFF;
+
+/**
+ * @enum PlacementStrategy
+ * @brief Enumerates the ways the PlacementPolicy chooses a memory bank.
+ *
+ * - FIXED:         Always use PlacementConfig::default_bank.
+ * - ROUND_ROBIN:   Spread successive buffers across all the banks.
+ * - LEAST_LOADED:  Use the bank with the fewest allocated bytes.
+ */
+enum class PlacementStrategy { FIXED, ROUND_ROBIN, LEAST_LOADED };
+
+/**
+ * @enum BufferRole
+ * @brief Enumerates the kinds of buffers placed by the PlacementPolicy.
+ *
+ * - DEVICE_IO:    Buffer in device memory, read or written by the NPU.
+ * - HOST_STAGING: Host buffer from which or into which device buffers are
+ * copied.
+ */
+enum class BufferRole { DEVICE_IO, HOST_STAGING };
+
+/**
+ * @struct PlacementConfig
+ * @brief Configuration of a PlacementPolicy.
+ *
+ * @var PlacementConfig::strategy
+ *   Strategy used to choose the bank of DEVICE_IO buffers.
+ * @var PlacementConfig::default_bank
+ *   Bank used by PlacementStrategy::FIXED.
+ * @var PlacementConfig::numa_node
+ *   NUMA node of HOST_STAGING buffers and worker threads. -1 uses the node
+ * nearest to the device, read from its PCIe sysfs entry.
+ * @var PlacementConfig::bind_host_buffers
+ *   If true, HOST_STAGING buffers are bound to numa_node with mbind().
+ * @var PlacementConfig::bind_worker_threads
+ *   If true, the runtime worker threads are restricted to the CPUs of
+ * numa_node.
+ */
+struct PlacementConfig {
+  PlacementStrategy strategy = PlacementStrategy::ROUND_ROBIN;
+  uint8_t default_bank = 0;
+  int32_t numa_node = -1;
+  bool bind_host_buffers = true;
+  bool bind_worker_threads = true;
+};
+
+/**
+ * @struct BankStats
+ * @brief Counters of one device memory bank.
+ *
+ * @var BankStats::bank_idx
+ *   Index of the bank.
+ * @var BankStats::num_buffers
+ *   Number of buffers currently allocated in the bank.
+ * @var BankStats::allocated_bytes
+ *   Bytes currently allocated in the bank.
+ * @var BankStats::bytes_to_device
+ *   Bytes copied or synchronized from the host into the bank.
+ * @var BankStats::bytes_from_device
+ *   Bytes copied or synchronized from the bank to the host.
+ * @var BankStats::bandwidth_gbps
+ *   Mean transfer bandwidth of the bank since the last reset, in GB/s:
+ * bytes_to_device plus bytes_from_device, divided by the total duration of
+ * these copies and synchronizations. Time without transfers is not counted,
+ * so this is the achieved bandwidth, not the bank utilization.
+ */
+struct BankStats {
+  uint8_t bank_idx;
+  uint32_t num_buffers;
+  uint64_t allocated_bytes;
+  uint64_t bytes_to_device;
+  uint64_t bytes_from_device;
+  double bandwidth_gbps;
+};
+
+/**
+ * @struct NumaNodeStats
+ * @brief Counters of one host NUMA node.
+ *
+ * @var NumaNodeStats::node
+ *   Index of the node.
+ * @var NumaNodeStats::allocated_bytes
+ *   Bytes of HOST_STAGING buffers currently allocated on the node.
+ * @var NumaNodeStats::local_bytes
+ *   Bytes transferred between the device and buffers of this node by threads
+ * running on this node.
+ * @var NumaNodeStats::remote_bytes
+ *   Bytes transferred between the device and buffers of this node by threads
+ * running on another node.
+ * @var NumaNodeStats::bandwidth_gbps
+ *   Mean transfer bandwidth of the node since the last reset, in GB/s:
+ * local_bytes plus remote_bytes, divided by the total duration of these
+ * transfers, as for BankStats::bandwidth_gbps.
+ */
+struct NumaNodeStats {
+  int32_t node;
+  uint64_t allocated_bytes;
+  uint64_t local_bytes;
+  uint64_t remote_bytes;
+  double bandwidth_gbps;
+};
+
+/**
+ * @class PlacementPolicy
+ * @brief Chooses the memory bank and NUMA node of the buffers of a device.
+ *
+ * Memory, VideoFrame and NpuRunner::malloc_buffer() allocations made with
+ * PLACEMENT_AUTO_BANK go through the policy of their device, which spreads
+ * them across the device memory banks. Memory and VideoFrame take the device
+ * as a constructor argument. NpuRunner::malloc_buffer() has no device
+ * argument: the NpuRunner of a Runner created by RunnerFactory uses the
+ * policy of Runner::get_device(), set with the "device" runner option, and an
+ * NpuRunner constructed directly uses the policy of the device of index 0,
+ * the device it executes on. Host staging buffers are allocated on
+ * the NUMA node nearest to the device, and runtime worker threads run on the
+ * CPUs of that node, so that transfers do not cross the socket interconnect.
+ *
+ * Host placement uses libnuma when available and falls back to mbind() and
+ * sched_setaffinity(). On single-node hosts, host placement has no effect.
+ *
+ * The policy is thread-safe.
+ */
+class PlacementPolicy {
+ public:
+  /**
+   * @brief Returns the placement policy of a device.
+   *
+   * @param device Device handle.
+   * @return std::shared_ptr<PlacementPolicy> The policy shared by all the
+   * allocations on the device.
+   */
+  static std::shared_ptr<PlacementPolicy> get(std::shared_ptr<Device> device);
+
+  ~PlacementPolicy();
+
+  PlacementPolicy(const PlacementPolicy& other) = delete;
+  PlacementPolicy& operator=(const PlacementPolicy& other) = delete;
+
+  /**
+   * @brief Sets the policy configuration.
+   *
+   * Affects subsequent allocations only.
+   *
+   * @param config Policy configuration.
+   */
+  void configure(const PlacementConfig& config);
+
+  /**
+   * @brief Chooses the bank of a device buffer.
+   *
+   * @param size Size of the buffer in bytes.
+   * @return uint8_t Index of the chosen bank.
+   */
+  uint8_t select_bank(size_t size);
+
+  /**
+   * @brief Allocates a host staging buffer on the NUMA node of the policy.
+   *
+   * @param size Size of the buffer in bytes.
+   * @return void* Page-aligned buffer, to be released with free_host().
+   * @throw std::bad_alloc if the buffer cannot be allocated.
+   */
+  void* alloc_host(size_t size);
+
+  /**
+   * @brief Releases a buffer allocated with alloc_host().
+   *
+   * @param ptr Buffer to release.
+   * @param size Size passed to alloc_host().
+   */
+  void free_host(void* ptr, size_t size);
+
+  /**
+   * @brief Restricts the calling thread to the CPUs of the NUMA node of the
+   * policy.
+   *
+   * Use for application threads that fill or read the device buffers.
+   */
+  void bind_current_thread() const;
+
+  /**
+   * @brief Returns the NUMA node used by the policy.
+   *
+   * @return int32_t The node, or -1 if the host has a single node.
+   */
+  int32_t get_numa_node() const;
+
+  /**
+   * @brief Returns the counters of each memory bank of the device.
+   *
+   * @return std::vector<BankStats> One entry per bank.
+   */
+  std::vector<BankStats> get_bank_stats() const;
+
+  /**
+   * @brief Returns the counters of each NUMA node of the host.
+   *
+   * @return std::vector<NumaNodeStats> One entry per node.
+   */
+  std::vector<NumaNodeStats> get_node_stats() const;
+
+  /**
+   * @brief Resets the transfer counters and bandwidth measurements.
+   */
+  void reset_stats();
+
+ private:
+  explicit PlacementPolicy(std::shared_ptr<Device> device);
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;  // Bank allocation and transfer counters
+};
+
+}  // namespace vart
@@ -0,0 +1,288 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "vart_inferresult.hpp"
+
+namespace vart {
+
+/**
+ * @struct ResultRef
+ * @brief Read-only view of one result stored in a ResultArena.
+ *
+ * For classification results, the box fields are zero.
+ *
+ * @var ResultRef::index
+ *   Index of the result in the arena.
+ * @var ResultRef::frame
+ *   Index of the frame in the batch.
+ * @var ResultRef::parent
+ *   Index of the parent result, or ResultArena::NO_PARENT for a top-level
+ * result.
+ * @var ResultRef::x
+ *   X coordinate of the top left corner of the bounding box.
+ * @var ResultRef::y
+ *   Y coordinate of the top left corner of the bounding box.
+ * @var ResultRef::width
+ *   Width of the bounding box.
+ * @var ResultRef::height
+ *   Height of the bounding box.
+ * @var ResultRef::score
+ *   Confidence score of the result.
+ * @var ResultRef::label
+ *   Index of the label. See ResultArena::get_label_name().
+ */
+struct ResultRef {
+  uint32_t index;
+  uint32_t frame;
+  int32_t parent;
+  int32_t x;
+  int32_t y;
+  uint32_t width;
+  uint32_t height;
+  float score;
+  int32_t label;
+};
+
+/**
+ * @class ResultArena
+ * @brief Flat, structure-of-arrays storage for the results of one batch.
+ *
+ * ResultArena stores the inference results of all frames of a batch in
+ * contiguous arrays of boxes, scores, labels and parent indices, grouped by
+ * frame. The hierarchy of InferResult is represented by parent indices
+ * instead of shared and weak pointers, so a batch of thousands of detections
+ * costs a few array appends instead of thousands of heap allocations and
+ * atomic reference count updates. reset() releases all results in one shot
+ * and keeps the capacity for the next batch.
+ *
+ * Results of a frame must be added after the results of the previous frame,
+ * and a child after its parent.
+ *
+ * DetectionPostProcess::process() writes its results directly into an arena.
+ * Consumers written against InferResult can use to_infer_results(), which
+ * builds the equivalent InferResult trees.
+ */
+class ResultArena {
+ public:
+  /**
+   * @brief Parent index of a top-level result.
+   */
+  static constexpr int32_t NO_PARENT = -1;
+
+  /**
+   * @brief Constructs an empty arena.
+   *
+   * @param capacity Number of results to reserve room for.
+   * @param labels Label names, indexed by label. Shared between arenas.
+   */
+  explicit ResultArena(
+      size_t capacity = 1024,
+      std::shared_ptr<const std::vector<std::string>> labels = nullptr);
+
+  /**
+   * @brief Removes all results and frames, keeping the allocated capacity.
+   *
+   * @param num_frames Number of frames of the next batch.
+   */
+  void reset(uint32_t num_frames);
+
+  /**
+   * @brief Appends a detection result.
+   *
+   * @param frame Index of the frame in the batch.
+   * @param parent Index of the parent result, or NO_PARENT.
+   * @param x X coordinate of the top left corner of the bounding box.
+   * @param y Y coordinate of the top left corner of the bounding box.
+   * @param width Width of the bounding box.
+   * @param height Height of the bounding box.
+   * @param score Confidence score.
+   * @param label Index of the label.
+   * @return uint32_t Index of the new result.
+   */
+  uint32_t add(uint32_t frame,
+               int32_t parent,
+               int32_t x,
+               int32_t y,
+               uint32_t width,
+               uint32_t height,
+               float score,
+               int32_t label);
+
+  /**
+   * @brief Appends a classification result.
+   *
+   * @param frame Index of the frame in the batch.
+   * @param parent Index of the parent result, or NO_PARENT.
+   * @param score Confidence score.
+   * @param label Index of the label.
+   * @return uint32_t Index of the new result.
+   */
+  uint32_t add(uint32_t frame, int32_t parent, float score, int32_t label);
+
+  /**
+   * @brief Returns the total number of results.
+   *
+   * @return The number of results of all frames.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the number of frames of the batch.
+   *
+   * @return The number of frames.
+   */
+  uint32_t get_num_frames() const;
+
+  /**
+   * @brief Returns the range of result indices of a frame.
+   *
+   * @param frame Index of the frame in the batch.
+   * @return The first index and one past the last index of the results of
+   * the frame.
+   */
+  std::pair<uint32_t, uint32_t> get_frame_range(uint32_t frame) const;
+
+  /**
+   * @brief Returns a view of a result.
+   *
+   * @param index Index of the result.
+   * @return ResultRef The result.
+   */
+  ResultRef get(uint32_t index) const;
+
+  /**
+   * @brief Returns the name of a label.
+   *
+   * @param label Index of the label.
+   * @return The label name, or an empty string if no label table was given.
+   */
+  const std::string& get_label_name(int32_t label) const;
+
+  /**
+   * @brief Returns the score column, for vectorized processing.
+   *
+   * Like the other column accessors below, returns a pointer to size()
+   * contiguous values indexed by result index, where the results of frame f
+   * occupy get_frame_range(f). The pointer is invalidated by add() and
+   * reset().
+   *
+   * @return Pointer to the confidence scores.
+   */
+  const float* get_scores() const;
+
+  /**
+   * @brief Returns the column of box left coordinates, in pixels of the frame
+   * the results refer to. Zero for classification results.
+   */
+  const int32_t* get_x() const;
+
+  /**
+   * @brief Returns the column of box top coordinates, in pixels of the frame
+   * the results refer to. Zero for classification results.
+   */
+  const int32_t* get_y() const;
+
+  /**
+   * @brief Returns the column of box widths, in pixels. Zero for
+   * classification results.
+   */
+  const uint32_t* get_widths() const;
+
+  /**
+   * @brief Returns the column of box heights, in pixels. Zero for
+   * classification results.
+   */
+  const uint32_t* get_heights() const;
+
+  /**
+   * @brief Returns the column of label indices. See get_label_name().
+   */
+  const int32_t* get_labels() const;
+
+  /**
+   * @brief Returns the column of parent result indices.
+   *
+   * A parent index is an index into the same columns, lower than the index of
+   * the child, or NO_PARENT (-1) for a top-level result.
+   */
+  const int32_t* get_parents() const;
+
+  /**
+   * @brief Calls a visitor for each result of a frame, parents before their
+   * children.
+   *
+   * The visitor must accept a const ResultRef&. Since children are added
+   * after their parents, visiting the results of the frame in index order
+   * visits parents first. Defined in the header, so the visitor can be
+   * inlined into the loop. No memory is allocated.
+   *
+   * @param frame Index of the frame in the batch. Nothing is visited if frame
+   * is not lower than get_num_frames().
+   * @param visitor Callable invoked for each result.
+   */
+  template <typename Visitor>
+  void visit(uint32_t frame, Visitor&& visitor) const;
+
+  /**
+   * @brief Builds InferResult trees from the arena.
+   *
+   * Adapter for consumers written against InferResult. Allocates one
+   * InferResult per result.
+   *
+   * @return The top-level results of each frame, vector dimensions:
+   * [frame][results], as returned by PostProcess::process().
+   */
+  std::vector<std::vector<std::shared_ptr<InferResult>>> to_infer_results()
+      const;
+
+ private:
+  std::vector<uint32_t> frame_offsets_;  // First result index of each frame
+  std::vector<int32_t> parents_;         // Parent index of each result
+  std::vector<int32_t> x_;               // Box left coordinates
+  std::vector<int32_t> y_;               // Box top coordinates
+  std::vector<uint32_t> widths_;         // Box widths
+  std::vector<uint32_t> heights_;        // Box heights
+  std::vector<float> scores_;            // Confidence scores
+  std::vector<int32_t> labels_;          // Label indices
+  std::shared_ptr<const std::vector<std::string>> label_names_;  // Labels
+};
+
+template <typename Visitor>
+inline void ResultArena::visit(uint32_t frame, Visitor&& visitor) const {
+  if (frame >= frame_offsets_.size()) {
+    return;
+  }
+  const uint32_t begin = frame_offsets_[frame];
+  const uint32_t end = frame + 1 < frame_offsets_.size()
+                           ? frame_offsets_[frame + 1]
+                           : static_cast<uint32_t>(scores_.size());
+  for (uint32_t i = begin; i < end; ++i) {
+    const ResultRef ref = {i, frame, parents_[i], x_[i], y_[i],
+                           widths_[i], heights_[i], scores_[i], labels_[i]};
+    visitor(ref);
+  }
+}
+
+}  // namespace vart
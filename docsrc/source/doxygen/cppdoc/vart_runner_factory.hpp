@@ -21,10 +21,13 @@
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "vart_device.hpp"
+#include "vart_logger.hpp"
 #include "vart_npu_tensor.hpp"
 
 namespace vart {
@@ -38,8 +41,52 @@ namespace vart {
  * model.
  *
  * - VAIML:   VAIML-based runner implementation.
+ * - CPU_REF: Host-only reference runner. Implements the full Runner contract
+ * without an NPU by emulating each job with a configurable cost model. See
+ * CpuRefCostModel.
  */
-enum class RunnerType { VAIML };
+enum class RunnerType { VAIML, CPU_REF };
+
+/**
+ * @struct CpuRefCostModel
+ * @brief Per-job cost model used by the RunnerType::CPU_REF runner.
+ *
+ * The CPU reference runner does not compute real model outputs. Each job
+ * occupies one of its worker threads for a time derived from this cost model,
+ * so that the host-side submission, queueing and completion paths can be
+ * benchmarked and regression tested on machines without an NPU.
+ *
+ * The emulated execution time of a job is:
+ * fixed_us + per_batch_us * batch + per_byte_ns * bytes / 1000, where batch is
+ * the number of batch entries of the job and bytes is the total size of its
+ * input and output tensors. A uniformly distributed jitter of up to jitter_us
+ * is added when non-zero.
+ *
+ * The cost model is passed to RunnerFactory::create_runner() through the
+ * "cost_model" option.
+ *
+ * @var CpuRefCostModel::fixed_us
+ *   Fixed cost of each job in microseconds.
+ * @var CpuRefCostModel::per_batch_us
+ *   Additional cost per batch entry in microseconds.
+ * @var CpuRefCostModel::per_byte_ns
+ *   Additional cost per byte of input and output data in nanoseconds.
+ * @var CpuRefCostModel::jitter_us
+ *   Maximum random jitter added to each job in microseconds.
+ * @var CpuRefCostModel::copy_data
+ *   When true, input data is copied to the outputs so that the memory traffic
+ *   of a real job is reproduced. When false, output buffers are left untouched.
+ * @var CpuRefCostModel::seed
+ *   Seed of the jitter generator, for reproducible runs.
+ */
+struct CpuRefCostModel {
+  uint32_t fixed_us = 0;
+  uint32_t per_batch_us = 0;
+  uint32_t per_byte_ns = 0;
+  uint32_t jitter_us = 0;
+  bool copy_data = false;
+  uint32_t seed = 0;
+};
 
 /**
  * @enum RoundingMode
@@ -78,6 +125,71 @@ struct QuantParameters {
   RoundingMode rounding_mode;
 };
 
+/**
+ * @struct TensorHandle
+ * @brief Stable handle to a tensor of a runner.
+ *
+ * A handle is resolved once from a tensor name with
+ * Runner::get_tensor_handle() and stays valid for the lifetime of the runner.
+ * Lookups through a handle are array accesses, without string hashing or
+ * comparison, and are meant for per-frame code.
+ *
+ * @var TensorHandle::direction
+ *   Direction of the tensor.
+ * @var TensorHandle::index
+ *   Position of the tensor in the vector returned by
+ * Runner::get_tensors_info() for this direction. The position is the same for
+ * TensorType::CPU and TensorType::HW.
+ */
+struct TensorHandle {
+  TensorDirection direction;
+  uint32_t index;
+};
+
+/**
+ * @struct RunnerOptions
+ * @brief Typed runner options.
+ *
+ * Typed equivalent of the options map accepted by
+ * RunnerFactory::create_runner(). The map is parsed and validated into a
+ * RunnerOptions once, when the runner is created; the runner never reads the
+ * map afterwards. See create_runner() for the meaning of each option.
+ *
+ * @var RunnerOptions::input_tensor_type
+ *   Type of the tensors passed as inputs ("input_tensor_type").
+ * @var RunnerOptions::output_tensor_type
+ *   Type of the tensors passed as outputs ("output_tensor_type").
+ * @var RunnerOptions::max_inflight_jobs
+ *   Capacity of the asynchronous job table ("max_inflight_jobs").
+ * @var RunnerOptions::use_model_cache
+ *   Whether the prepared model is shared through the ModelCache
+ * ("use_model_cache").
+ * @var RunnerOptions::cost_model
+ *   Per-job cost model of RunnerType::CPU_REF ("cost_model").
+ * @var RunnerOptions::batch_size
+ *   Batch size of RunnerType::CPU_REF ("batch_size"). 0 uses the batch size
+ * of the model.
+ * @var RunnerOptions::num_workers
+ *   Worker threads of RunnerType::CPU_REF ("num_workers").
+ * @var RunnerOptions::device
+ *   Device the runner executes on ("device"). nullptr lets the runner open
+ * its default device.
+ * @var RunnerOptions::log_level
+ *   Log level of the runner ("log_level"). std::nullopt, the default, keeps
+ * the level configured in Logger.
+ */
+struct RunnerOptions {
+  TensorType input_tensor_type = TensorType::CPU;
+  TensorType output_tensor_type = TensorType::CPU;
+  uint32_t max_inflight_jobs = 256;
+  bool use_model_cache = true;
+  CpuRefCostModel cost_model;
+  uint32_t batch_size = 0;
+  uint32_t num_workers = 1;
+  std::shared_ptr<Device> device;
+  std::optional<LogLevel> log_level;
+};
+
 /**
  * @enum StatusCode
  * @brief Enumerates the status codes used in the VART.
@@ -112,16 +224,62 @@ enum class StatusCode {
  * This struct holds the status of a submitted job, including whether it was
  * successfully submitted and its unique identifier.
  *
- * @var JobHandle::submitted
+ * @var JobHandle::status
  *   Indicates whether the job was successfully submitted.
+ *   StatusCode::OUT_OF_MEMORY means that the runner already has the maximum
+ * number of jobs in flight (see the "max_inflight_jobs" runner option); the
+ * job can be resubmitted once an earlier job has been waited on.
  * @var JobHandle::job_id
- *   Unique identifier for the job.
+ *   Unique identifier for the job. A job_id is never reused while the job it
+ * identifies is in flight, and remains valid until wait() has reported the
+ * completion of the job. Waiting on a job_id whose completion was already
+ * reported returns StatusCode::INVALID_INPUT.
+ *   A job_id combines the slot of the job in the job table with a generation
+ * counter incremented each time the slot is reused. The slot takes the low
+ * ceil(log2(max_inflight_jobs)) bits, so the generation wraps after
+ * 2^32 / P reuses of a slot, where P is max_inflight_jobs rounded up to the
+ * next power of two (16777216 with the default of 256, and also with 200).
+ * After the wrap, a stale job_id can match a newer job. The INVALID_INPUT
+ * guarantee only holds before the wrap; a job_id must not be waited on again
+ * after its completion was reported.
  */
 struct JobHandle {
   StatusCode status;  // Submission status of the job.
   uint32_t job_id;    // Unique identifier for the job.
 };
 
+/**
+ * @struct TransferStats
+ * @brief Counters of the data movement performed by a Runner.
+ *
+ * Counts the host-side work done by the runner to move data between the
+ * tensors supplied by the user and the buffers accessed by the hardware. With
+ * TensorType::HW, MemoryType::DEVICE input and output tensors, all byte
+ * counters stay at zero.
+ *
+ * @var TransferStats::num_inferences
+ *   Number of jobs executed.
+ * @var TransferStats::bytes_copied
+ *   Bytes copied between user buffers and internal device buffers without
+ * any format change.
+ * @var TransferStats::bytes_converted
+ *   Bytes written by data type or memory layout conversions between
+ * TensorType::CPU and TensorType::HW formats.
+ * @var TransferStats::num_conversions
+ *   Number of tensors that went through a data type or memory layout
+ * conversion.
+ * @var TransferStats::bytes_synced
+ *   Bytes of device buffers synchronized between host caches and device
+ * memory.
+ */
+struct TransferStats {
+  uint64_t num_inferences;
+  uint64_t bytes_copied;
+  uint64_t bytes_converted;
+  uint64_t num_conversions;
+  uint64_t bytes_synced;
+};
+
 /**
  * @class Runner
  * @brief Abstract base class for executing model inference operations.
@@ -210,6 +368,57 @@ class Runner {
   virtual const QuantParameters& get_quant_parameters(
       const std::string& tensor_name) const = 0;
 
+  /**
+   * @brief Resolves a tensor name into a stable handle.
+   *
+   * Call once, outside the per-frame path, and use
+   * get_tensor_info_by_handle() and get_quant_parameters_by_handle()
+   * afterwards.
+   *
+   * The default implementation searches the tensors returned by
+   * get_tensors_info() for each direction, comparing names.
+   *
+   * @param tensor_name The name of the tensor.
+   * @return TensorHandle The handle of the tensor.
+   * @throw std::invalid_argument if the runner has no tensor with this name.
+   */
+  virtual TensorHandle get_tensor_handle(const std::string& tensor_name) const;
+
+  /**
+   * @brief Retrieves tensor information through a handle.
+   *
+   * Same as get_tensor_info_by_name(), as an O(1) array access.
+   *
+   * The default implementation returns
+   * get_tensors_info(handle.direction, type)[handle.index].
+   *
+   * @param handle Handle returned by get_tensor_handle().
+   * @param type Specifies whether to retrieve CPU or HW tensor information.
+   * @return A constant reference to the NpuTensorInfo object describing the
+   * tensor.
+   */
+  virtual const NpuTensorInfo& get_tensor_info_by_handle(
+      const TensorHandle& handle,
+      const TensorType& type) const;
+
+  /**
+   * @brief Retrieves the quantization parameters of a tensor through a handle.
+   *
+   * Same as get_quant_parameters(const std::string&).
+   *
+   * The default implementation calls get_quant_parameters() with the name of
+   * the tensor, so it costs a name lookup. Runners built by RunnerFactory
+   * override it with an O(1) array access, and the wrapping runners
+   * (RunnerPool, CachingRunner and the runners returned by
+   * DeviceScheduler::register_runner()) forward it to the wrapped runner.
+   *
+   * @param handle Handle returned by get_tensor_handle().
+   * @return A QuantParameters object containing the scale factor and optional
+   * zero point.
+   */
+  virtual const QuantParameters& get_quant_parameters_by_handle(
+      const TensorHandle& handle) const;
+
   /**
    * @brief Returns the number of input tensors.
    *
@@ -254,6 +463,13 @@ class Runner {
    * @return A StatusCode indicating the success, failure, etc of the execution.
    * @note Users should provide tensors in the same order as returned by
    * get_tensors_info().
+   * @note A TensorType::CPU, MemoryType::HOST input tensor may be a strided
+   * view: its NpuTensorInfo::strides may be larger than those of a packed
+   * tensor of the same shape, for example for a tile of a larger image. The RunnerType::VAIML runner reads such inputs with their
+   * strides while converting them to the hardware format, and the
+   * RunnerType::CPU_REF runner accepts them. TensorType::HW tensors and
+   * output tensors must be packed. The same applies to execute_async() and
+   * execute_async_batch().
    */
   virtual StatusCode execute(const std::vector<std::vector<NpuTensor>>& inputs,
                              std::vector<std::vector<NpuTensor>>& outputs) = 0;
@@ -292,6 +508,9 @@ class Runner {
    * return immediately. If a positive timeout is specified, the wait will
    * return once the task is completed, or the specified time has elapsed.
    * @return StatusCode The status of the wait operation.
+   * @note execute_async() and wait() may be called concurrently from multiple
+   * threads. A job may be waited on from a thread other than the one that
+   * submitted it.
    */
   virtual StatusCode wait(const JobHandle& job_handle,
                           unsigned int timeout) = 0;
@@ -335,6 +554,110 @@ class Runner {
       std::vector<std::vector<NpuTensor>>& outputs,
       ExecuteAsyncCallback cb,
       unsigned int timeout) = 0;
+
+  /**
+   * @brief Submits several independent jobs asynchronously in one call.
+   *
+   * Each job has the same structure as the inputs and outputs of
+   * execute_async(). The runner validates all jobs, reserves their job slots
+   * and pushes them to the device command queue together, so the per-job
+   * submission overhead is paid once per call instead of once per job.
+   *
+   * @param inputs Input tensors of each job, vector dimensions:
+   * [job][batch][tensors].
+   * @param outputs Output tensors of each job, vector dimensions:
+   * [job][batch][tensors]. Must have the same number of jobs as inputs.
+   * @return One JobHandle per job, in submission order. A job that could not
+   * be submitted has a status other than StatusCode::SUCCESS; the other jobs
+   * are still submitted.
+   * @note The default implementation calls execute_async() for each job.
+   * @note Users should provide tensors in the same order as returned by
+   * get_tensors_info().
+   */
+  virtual std::vector<JobHandle> execute_async_batch(
+      const std::vector<std::vector<std::vector<NpuTensor>>>& inputs,
+      std::vector<std::vector<std::vector<NpuTensor>>>& outputs);
+
+  /**
+   * @brief Waits for the completion of all the given jobs.
+   *
+   * Handles whose status is not StatusCode::SUCCESS, such as the jobs of
+   * execute_async_batch() that could not be submitted, are skipped: their
+   * entry in job_status is set to their submission status and they do not
+   * affect the return value.
+   *
+   * Each job that completes is released, whatever the return value. Jobs that
+   * are still running when the timeout expires are not released; their entry
+   * in job_status is StatusCode::TIMEOUT and they can be waited on again, for
+   * example by calling wait_all() with only the handles whose entry is
+   * StatusCode::TIMEOUT.
+   *
+   * @param job_handles Handles of the jobs to wait for, as returned by
+   * execute_async() or execute_async_batch().
+   * @param timeout The maximum time to wait in milliseconds for all jobs
+   * together. Zero timeout checks the completion status and returns
+   * immediately.
+   * @param job_status Resized to the size of job_handles and set to the
+   * status of each job: the completion status of the job, StatusCode::TIMEOUT
+   * if it is still running, or its submission status if it was skipped.
+   * @return StatusCode::SUCCESS if all submitted jobs completed successfully,
+   * StatusCode::TIMEOUT if at least one job is still running when the timeout
+   * expires, or the first error status reported by a job otherwise.
+   */
+  virtual StatusCode wait_all(const std::vector<JobHandle>& job_handles,
+                              unsigned int timeout,
+                              std::vector<StatusCode>& job_status);
+
+  /**
+   * @brief Waits for the completion of any of the given jobs.
+   *
+   * Handles whose status is not StatusCode::SUCCESS are skipped and never
+   * reported as completed.
+   *
+   * @param job_handles Handles of the jobs to wait for, as returned by
+   * execute_async() or execute_async_batch().
+   * @param timeout The maximum time to wait in milliseconds. Zero timeout
+   * checks the completion status and returns immediately.
+   * @param completed_index Set to the index in job_handles of the completed
+   * job when the return value is not StatusCode::TIMEOUT. Only this job is
+   * released; the others can be waited on again.
+   * @return The status of the completed job, StatusCode::TIMEOUT if no job
+   * completed before the timeout expired, or StatusCode::INVALID_INPUT if no
+   * handle was submitted.
+   */
+  virtual StatusCode wait_any(const std::vector<JobHandle>& job_handles,
+                              unsigned int timeout,
+                              size_t& completed_index);
+
+  /**
+   * @brief Returns the device the runner executes on.
+   *
+   * Components that keep per-device state, such as DeviceScheduler and
+   * PlacementPolicy, use it to associate a runner with its device.
+   *
+   * @return std::shared_ptr<Device> The device given with the "device" runner
+   * option, or the default device opened by the runner. nullptr for a
+   * RunnerType::CPU_REF runner created without the "device" option, and in
+   * the default implementation.
+   */
+  virtual std::shared_ptr<Device> get_device() const;
+
+  /**
+   * @brief Returns the data movement counters of the runner.
+   *
+   * Use these counters to verify that a zero-copy configuration performs no
+   * copy or conversion: after running inference with TensorType::HW,
+   * MemoryType::DEVICE tensors, bytes_copied and bytes_converted are zero.
+   *
+   * @return TransferStats The counters accumulated since the runner was
+   * created or since the last call to reset_transfer_stats().
+   */
+  virtual TransferStats get_transfer_stats() const;
+
+  /**
+   * @brief Resets the data movement counters of the runner.
+   */
+  virtual void reset_transfer_stats();
 };
 
 /**
@@ -360,11 +683,84 @@ class RunnerFactory {
    * each option is identified by a string key and can hold a value of any type.
    * @return std::shared_ptr<Runner> A shared pointer to the created Runner
    * instance.
+   *
+   * Options common to all runner types:
+   * - "input_tensor_type" (std::string or const char*): "CPU" or "HW". With
+   * "HW", the input tensors passed to execute() and execute_async() must be
+   * TensorType::HW, MemoryType::DEVICE tensors already in the hardware format;
+   * the runner hands them to the hardware without any reorder, conversion or
+   * copy. Defaults to "CPU".
+   * - "output_tensor_type" (std::string or const char*): "CPU" or "HW". Same
+   * as input_tensor_type, for output tensors. Defaults to "CPU".
+   * - "max_inflight_jobs" (uint32_t): Capacity of the table tracking jobs
+   * submitted with execute_async(). The table is preallocated when the runner
+   * is created, so submission and completion do not allocate or take a global
+   * lock. Defaults to 256.
+   * - "device" (std::shared_ptr<Device>): Device the runner executes on, as
+   * returned by Device::get_device_hdl(). Defaults to the device of index 0.
+   * A RunnerType::CPU_REF runner only records it, so that it can be
+   * registered with the DeviceScheduler of the device.
+   * - "log_level" (std::string or const char*): "ERROR", "WARNING", "FIXME",
+   * "INFO" or "DEBUG". Log level of the runner. Defaults to the level
+   * configured in Logger.
+   * - "use_model_cache" (bool): If true, the prepared model is shared through
+   * the ModelCache with the other runners created from the same model and
+   * options, or mapped from a snapshot. Defaults to true.
+   *
+   * Options specific to RunnerType::CPU_REF:
+   * - "cost_model" (CpuRefCostModel): Per-job cost model. Defaults to a zero
+   * cost model, where jobs complete as soon as a worker picks them up.
+   * - "batch_size" (uint32_t): Batch size reported by get_batch_size().
+   * Defaults to the batch size of the model.
+   * - "num_workers" (uint32_t): Number of worker threads executing jobs
+   * concurrently, emulating hardware contexts. Defaults to 1.
+   *
+   * The CPU_REF runner reads the tensor metadata and quantization parameters
+   * from the compiled model in model_path, so get_tensors_info() and
+   * get_quant_parameters() return the same values as the VAIML runner.
+   *
+   * The options are parsed into a RunnerOptions when the runner is created.
+   * Options with an unknown key are ignored, with a warning logged, so that
+   * options meant for other runtime versions do not prevent the runner
+   * creation.
+   * @throw std::invalid_argument if a known option has a value of the wrong
+   * type or an invalid value.
    */
   static std::shared_ptr<Runner> create_runner(
       RunnerType device,
       const std::string& model_path,
       const std::unordered_map<std::string, std::any>& options = {});
+
+  /**
+   * @brief Creates and returns a shared pointer to a Runner instance, with
+   * typed options.
+   *
+   * @param device The type of device on which the Runner will execute.
+   * @param model_path The file system path to the model to be loaded by the
+   * Runner.
+   * @param options Typed configuration options.
+   * @return std::shared_ptr<Runner> A shared pointer to the created Runner
+   * instance.
+   * @throw std::invalid_argument if an option has an invalid value.
+   */
+  static std::shared_ptr<Runner> create_runner_with_options(
+      RunnerType device,
+      const std::string& model_path,
+      const RunnerOptions& options);
+
+  /**
+   * @brief Parses and validates an options map.
+   *
+   * String options accept both std::string and const char* values. Unknown
+   * keys are ignored with a warning logged.
+   *
+   * @param options Options map, as accepted by create_runner().
+   * @return RunnerOptions The typed options.
+   * @throw std::invalid_argument if a known option has a value of the wrong
+   * type or an invalid value.
+   */
+  static RunnerOptions parse_options(
+      const std::unordered_map<std::string, std::any>& options);
 };
 
 }  // namespace vart
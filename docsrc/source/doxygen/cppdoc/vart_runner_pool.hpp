@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <any>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "vart_npu_tensor.hpp"
+#include "vart_runner_factory.hpp"
+#include "vart_stats.hpp"
+
+namespace vart {
+
+/**
+ * @struct RunnerInstanceStats
+ * @brief Scheduling statistics of one runner instance of a RunnerPool.
+ *
+ * @var RunnerInstanceStats::jobs_completed
+ *   Number of jobs completed by the instance.
+ * @var RunnerInstanceStats::jobs_stolen
+ *   Number of jobs the instance took from the queue of another instance.
+ * @var RunnerInstanceStats::queue_depth
+ *   Number of jobs currently queued on or executing on the instance.
+ * @var RunnerInstanceStats::max_queue_depth
+ *   Largest value reached by queue_depth.
+ * @var RunnerInstanceStats::latency
+ *   Execution latency of the jobs completed by the instance, from the start
+ * of execution to completion.
+ */
+struct RunnerInstanceStats {
+  uint64_t jobs_completed;
+  uint64_t jobs_stolen;
+  uint32_t queue_depth;
+  uint32_t max_queue_depth;
+  LatencySummary latency;
+};
+
+/**
+ * @class RunnerPool
+ * @brief Runner distributing jobs over several instances of the same model.
+ *
+ * RunnerPool creates K runners from the same model with
+ * RunnerFactory::create_runner(), typically to use several hardware contexts,
+ * and exposes them through the Runner interface. Jobs are dispatched by a
+ * work-stealing scheduler: each job goes to the instance with the lowest
+ * expected completion time, estimated from its queue depth and its recent
+ * completion latency, and an instance that becomes idle takes queued jobs from
+ * the most loaded instance. A slow job therefore delays only the jobs behind
+ * it until another instance frees up.
+ *
+ * Job handles returned by the pool are unique across all instances.
+ * Completion callbacks and wait() behave as for a single Runner.
+ */
+class RunnerPool : public Runner {
+ public:
+  /**
+   * @brief Creates a pool of runners.
+   *
+   * @param device The type of runner to create for each instance.
+   * @param model_path The file system path to the model.
+   * @param num_instances Number of runner instances.
+   * @param options Options passed to each RunnerFactory::create_runner()
+   * call.
+   * @return std::shared_ptr<RunnerPool> The created pool.
+   * @throw std::runtime_error if an instance cannot be created.
+   */
+  static std::shared_ptr<RunnerPool> create(
+      RunnerType device,
+      const std::string& model_path,
+      uint32_t num_instances,
+      const std::unordered_map<std::string, std::any>& options = {});
+
+  ~RunnerPool() override;
+
+  const std::vector<NpuTensorInfo>& get_tensors_info(
+      const TensorDirection& direction,
+      const TensorType& type) const override;
+
+  const NpuTensorInfo& get_tensor_info_by_name(
+      const std::string& tensor_name,
+      const TensorType& type) const override;
+
+  const QuantParameters& get_quant_parameters(
+      const std::string& tensor_name) const override;
+
+  /**
+   * @brief Resolves a tensor name into a handle valid for every instance.
+   *
+   * All instances are created from the same model and options, so they share
+   * the same tensors. This lookup and the handle-based lookups are forwarded
+   * to the first instance.
+   *
+   * See Runner::get_tensor_handle().
+   */
+  TensorHandle get_tensor_handle(const std::string& tensor_name) const override;
+
+  const NpuTensorInfo& get_tensor_info_by_handle(
+      const TensorHandle& handle,
+      const TensorType& type) const override;
+
+  const QuantParameters& get_quant_parameters_by_handle(
+      const TensorHandle& handle) const override;
+
+  /**
+   * @brief Returns the device shared by all instances.
+   *
+   * See Runner::get_device().
+   */
+  std::shared_ptr<Device> get_device() const override;
+
+  size_t get_num_input_tensors() const override;
+
+  size_t get_num_output_tensors() const override;
+
+  size_t get_batch_size() const override;
+
+  /**
+   * @brief Executes a job synchronously on the least loaded instance.
+   *
+   * See Runner::execute().
+   */
+  StatusCode execute(const std::vector<std::vector<NpuTensor>>& inputs,
+                     std::vector<std::vector<NpuTensor>>& outputs) override;
+
+  /**
+   * @brief Queues a job on the scheduler.
+   *
+   * See Runner::execute_async().
+   */
+  JobHandle execute_async(
+      const std::vector<std::vector<NpuTensor>>& inputs,
+      std::vector<std::vector<NpuTensor>>& outputs) override;
+
+  /**
+   * @brief Waits for a job submitted to the pool.
+   *
+   * The pool records the instance each job was dispatched to, and the
+   * instance-local handle it received, in a table indexed by the pool handle.
+   * The wait is forwarded to that instance, so waiting costs the same as on a
+   * single Runner. A job still queued in the scheduler is waited on until it is
+   * dispatched and completes, or the timeout expires. See Runner::wait().
+   */
+  StatusCode wait(const JobHandle& job_handle, unsigned int timeout) override;
+
+  /**
+   * @brief Queues a job on the scheduler with a completion callback.
+   *
+   * See Runner::execute_async().
+   */
+  StatusCode execute_async(const std::vector<std::vector<NpuTensor>>& inputs,
+                           std::vector<std::vector<NpuTensor>>& outputs,
+                           ExecuteAsyncCallback cb,
+                           unsigned int timeout) override;
+
+  /**
+   * @brief Returns the data movement counters of the pool.
+   *
+   * @return TransferStats The sum of the counters of all instances.
+   */
+  TransferStats get_transfer_stats() const override;
+
+  /**
+   * @brief Resets the data movement counters of all instances.
+   */
+  void reset_transfer_stats() override;
+
+  /**
+   * @brief Returns the number of runner instances.
+   *
+   * @return The number of instances.
+   */
+  size_t get_num_instances() const;
+
+  /**
+   * @brief Returns the scheduling statistics of each instance.
+   *
+   * @return One RunnerInstanceStats per instance.
+   */
+  std::vector<RunnerInstanceStats> get_instance_stats() const;
+
+ private:
+  RunnerPool(const std::string& model_path,
+             const std::unordered_map<std::string, std::any>& options);
+
+  struct Scheduler;
+  std::vector<std::shared_ptr<Runner>> instances_;  // Runner instances
+  std::unique_ptr<Scheduler> scheduler_;            // Work-stealing scheduler
+};
+
+}  // namespace vart
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vart_device.hpp"
+#include "vart_runner_factory.hpp"
+#include "vart_stats.hpp"
+
+namespace vart {
+
+/**
+ * @enum PriorityClass
+ * @brief Enumerates the priority classes of the DeviceScheduler.
+ *
+ * A pending job of a higher class is always issued to the device before the
+ * pending jobs of lower classes.
+ *
+ * - REALTIME: Latency-critical models, such as the first stage detector of a
+ * cascade.
+ * - NORMAL:   Default class.
+ * - BULK:     Throughput-oriented models, issued when no other job is pending.
+ */
+enum class PriorityClass { REALTIME, NORMAL, BULK };
+
+/**
+ * @struct SchedulerConfig
+ * @brief Configuration of a DeviceScheduler.
+ *
+ * @var SchedulerConfig::max_device_jobs
+ *   Maximum number of jobs issued to the device at a time. Jobs already on
+ * the device cannot be preempted, so this bounds the time a newly submitted
+ * REALTIME job waits behind jobs of lower classes.
+ */
+struct SchedulerConfig {
+  uint32_t max_device_jobs = 2;
+};
+
+/**
+ * @struct ModelScheduleConfig
+ * @brief Scheduling parameters of a runner registered with a DeviceScheduler.
+ *
+ * @var ModelScheduleConfig::name
+ *   Name used in the statistics.
+ * @var ModelScheduleConfig::priority
+ *   Priority class of the jobs of the runner.
+ * @var ModelScheduleConfig::weight
+ *   Weight of the runner within its priority class. Runners of the same class
+ * receive device time in proportion to their weights.
+ * @var ModelScheduleConfig::deadline_us
+ *   Relative deadline of each job, from its submission, in microseconds.
+ * Within a priority class, a job whose deadline would be missed otherwise is
+ * issued ahead of the weighted fair order. 0 means no deadline.
+ */
+struct ModelScheduleConfig {
+  std::string name;
+  PriorityClass priority = PriorityClass::NORMAL;
+  uint32_t weight = 1;
+  uint32_t deadline_us = 0;
+};
+
+/**
+ * @struct SchedulerClassStats
+ * @brief Queueing statistics of one priority class or registered runner.
+ *
+ * @var SchedulerClassStats::name
+ *   Name of the priority class or of the registered runner.
+ * @var SchedulerClassStats::jobs
+ *   Number of jobs issued to the device.
+ * @var SchedulerClassStats::device_time_us
+ *   Total device time used by the jobs, in microseconds.
+ * @var SchedulerClassStats::deadline_misses
+ *   Number of jobs that completed after their deadline.
+ * @var SchedulerClassStats::queue_delay_us
+ *   Time between the submission of a job and its issue to the device.
+ */
+struct SchedulerClassStats {
+  std::string name;
+  uint64_t jobs;
+  uint64_t device_time_us;
+  uint64_t deadline_misses;
+  LatencySummary queue_delay_us;
+};
+
+/**
+ * @class DeviceScheduler
+ * @brief Coordinates the jobs of several runners sharing one device.
+ *
+ * Runners executing on the same device, such as the detector and classifier
+ * of a cascade, otherwise issue their jobs independently, and a
+ * latency-critical job can wait behind a long batch of another model. Runners
+ * registered with a DeviceScheduler queue their jobs in the scheduler, which
+ * issues them to the device in priority class order, then by deadline, then
+ * by weighted fair share.
+ *
+ * There is one scheduler per device, shared by all the runners of the process
+ * executing on it; see get().
+ *
+ * A simulated scheduler, created with create_simulated(), drives a simulated
+ * device on a virtual clock instead of the NPU, to test scheduling policies
+ * on any Linux machine. Registered runners must be RunnerType::CPU_REF
+ * runners; each job takes the time given by their cost model. Virtual time
+ * advances only on the thread calling run_until_idle() or a blocking call of
+ * a scheduled runner: execute() runs the simulation until its own job
+ * completes, and wait(), wait_all() and wait_any() run it until the awaited
+ * jobs complete. Their timeouts are measured in virtual time, so they return
+ * StatusCode::TIMEOUT only if the jobs have not completed when the virtual
+ * clock reaches the timeout. Completion callbacks of execute_async() run on
+ * the thread driving the simulation. Runs are deterministic for a given
+ * submission sequence, and a simulated scheduler must be used from a single
+ * thread.
+ *
+ * As RunnerFactory::create_runner() does, register_runner() reports invalid
+ * arguments with std::invalid_argument. The scheduled runners report job
+ * errors with StatusCode, as any other Runner.
+ */
+class DeviceScheduler {
+ public:
+  /**
+   * @brief Returns the scheduler of a device.
+   *
+   * @param device Device handle.
+   * @return std::shared_ptr<DeviceScheduler> The scheduler shared by all the
+   * runners executing on the device.
+   */
+  static std::shared_ptr<DeviceScheduler> get(std::shared_ptr<Device> device);
+
+  /**
+   * @brief Creates a scheduler driving a simulated device.
+   *
+   * Each call creates an independent scheduler, not associated with any
+   * device.
+   *
+   * @param config Scheduler configuration.
+   * @return std::shared_ptr<DeviceScheduler> The simulated scheduler.
+   */
+  static std::shared_ptr<DeviceScheduler> create_simulated(
+      const SchedulerConfig& config = {});
+
+  ~DeviceScheduler();
+
+  DeviceScheduler(const DeviceScheduler& other) = delete;
+  DeviceScheduler& operator=(const DeviceScheduler& other) = delete;
+
+  /**
+   * @brief Sets the scheduler configuration.
+   *
+   * Affects the jobs issued after configure() returns.
+   *
+   * @param config Scheduler configuration.
+   */
+  void configure(const SchedulerConfig& config);
+
+  /**
+   * @brief Registers a runner with the scheduler.
+   *
+   * The returned runner implements the full Runner interface on top of the
+   * registered one. Its execute() and execute_async() calls queue the job in
+   * the scheduler; the other calls, including the handle-based tensor
+   * lookups and the transfer counters, are forwarded to the registered runner.
+   * The registered runner must not be used directly afterwards.
+   *
+   * @param runner Runner to register.
+   * @param config Scheduling parameters of the runner.
+   * @return std::shared_ptr<Runner> The scheduled runner.
+   * @throw std::invalid_argument if Runner::get_device() of the runner is not
+   * the device of the scheduler, or, for a simulated scheduler, if the runner
+   * is not a RunnerType::CPU_REF runner.
+   */
+  std::shared_ptr<Runner> register_runner(std::shared_ptr<Runner> runner,
+                                          const ModelScheduleConfig& config);
+
+  /**
+   * @brief Runs the simulated device until all the submitted jobs have
+   * completed.
+   *
+   * Only valid for a scheduler created with create_simulated().
+   *
+   * @return uint64_t The virtual time in microseconds when the last job
+   * completed.
+   */
+  uint64_t run_until_idle();
+
+  /**
+   * @brief Returns the queueing statistics of each priority class.
+   *
+   * @return std::vector<SchedulerClassStats> One entry per PriorityClass.
+   */
+  std::vector<SchedulerClassStats> get_class_stats() const;
+
+  /**
+   * @brief Returns the queueing statistics of each registered runner.
+   *
+   * @return std::vector<SchedulerClassStats> One entry per registered runner,
+   * in registration order.
+   */
+  std::vector<SchedulerClassStats> get_runner_stats() const;
+
+  /**
+   * @brief Resets all statistics.
+   */
+  void reset_stats();
+
+ private:
+  DeviceScheduler(std::shared_ptr<Device> device,
+                  const SchedulerConfig& config);
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;  // Per-class queues and issue thread
+};
+
+}  // namespace vart
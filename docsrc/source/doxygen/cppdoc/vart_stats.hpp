@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vart {
+
+/**
+ * @struct LatencySummary
+ * @brief Summary statistics of a series of latency measurements.
+ *
+ * Reported by the VART performance tools and components that track per-job or
+ * per-stage latency. All values are in microseconds.
+ *
+ * @var LatencySummary::count
+ *   Number of measurements.
+ * @var LatencySummary::min_us
+ *   Smallest measured latency.
+ * @var LatencySummary::mean_us
+ *   Arithmetic mean of the measured latencies.
+ * @var LatencySummary::p50_us
+ *   Median latency.
+ * @var LatencySummary::p99_us
+ *   99th percentile latency.
+ * @var LatencySummary::max_us
+ *   Largest measured latency.
+ */
+struct LatencySummary {
+  uint64_t count;
+  double min_us;
+  double mean_us;
+  double p50_us;
+  double p99_us;
+  double max_us;
+};
+
+/**
+ * @struct Histogram
+ * @brief Distribution of a series of measurements over fixed buckets.
+ *
+ * Bucket i counts the measurements in (upper_bounds[i - 1], upper_bounds[i]].
+ * The last element of counts counts the measurements above the last upper
+ * bound, so counts has one more element than upper_bounds.
+ *
+ * @var Histogram::upper_bounds
+ *   Inclusive upper bound of each bucket, in increasing order.
+ * @var Histogram::counts
+ *   Number of measurements in each bucket.
+ */
+struct Histogram {
+  std::vector<double> upper_bounds;
+  std::vector<uint64_t> counts;
+};
+
+}  // namespace vart
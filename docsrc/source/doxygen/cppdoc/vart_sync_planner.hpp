@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "vart/tensor_buffer.hpp"
+
+namespace vart {
+
+/**
+ * @enum SyncDirection
+ * @brief Enumerates the directions of a cache synchronization.
+ *
+ * - FOR_READ:  Make data written by the device visible to the host, as
+ * TensorBuffer::sync_for_read().
+ * - FOR_WRITE: Make data written by the host visible to the device, as
+ * TensorBuffer::sync_for_write().
+ */
+enum class SyncDirection { FOR_READ, FOR_WRITE };
+
+/**
+ * @struct SyncPlannerConfig
+ * @brief Configuration of a SyncPlanner.
+ *
+ * @var SyncPlannerConfig::merge_gap_bytes
+ *   Ranges of the same buffer separated by at most this many bytes are merged
+ * into one sync, even though the gap is synchronized needlessly. 0 merges
+ * only overlapping and adjacent ranges.
+ * @var SyncPlannerConfig::large_copy_bytes
+ *   Copies of at least this size use non-temporal stores, which do not evict
+ * the working set from the host caches, and are split across copy_threads
+ * threads.
+ * @var SyncPlannerConfig::copy_threads
+ *   Number of threads used for large copies.
+ */
+struct SyncPlannerConfig {
+  size_t merge_gap_bytes = 0;
+  size_t large_copy_bytes = 1024 * 1024;
+  uint32_t copy_threads = 1;
+};
+
+/**
+ * @struct SyncPlannerStats
+ * @brief Counters of a SyncPlanner.
+ *
+ * @var SyncPlannerStats::requested_syncs
+ *   Number of ranges passed to add_sync().
+ * @var SyncPlannerStats::issued_syncs
+ *   Number of TensorBuffer sync calls issued after merging.
+ * @var SyncPlannerStats::skipped_clean_syncs
+ *   Number of requested FOR_WRITE ranges skipped because they were still
+ * clean.
+ * @var SyncPlannerStats::bytes_synced
+ *   Bytes synchronized by the issued syncs.
+ * @var SyncPlannerStats::requested_copies
+ *   Number of copies passed to add_copy_from_host() and add_copy_to_host().
+ * @var SyncPlannerStats::issued_copies
+ *   Number of memory copies issued after merging contiguous copies.
+ * @var SyncPlannerStats::bytes_copied
+ *   Bytes copied by the issued copies.
+ */
+struct SyncPlannerStats {
+  uint64_t requested_syncs;
+  uint64_t issued_syncs;
+  uint64_t skipped_clean_syncs;
+  uint64_t bytes_synced;
+  uint64_t requested_copies;
+  uint64_t issued_copies;
+  uint64_t bytes_copied;
+};
+
+/**
+ * @class SyncPlanner
+ * @brief Batches the cache syncs and host copies of a job.
+ *
+ * Models with many small output heads issue dozens of tiny
+ * TensorBuffer::sync_for_read(), sync_for_write(), copy_from_host() and
+ * copy_to_host() calls per job. A SyncPlanner collects these requests across
+ * all the TensorBuffers of a job, merges overlapping and adjacent ranges of
+ * the same buffer, and issues the minimum number of calls in
+ * flush_for_device() and flush_for_host().
+ *
+ * The planner also tracks which ranges of each buffer are clean, that is,
+ * already synchronized for the device and not written by the host since. A
+ * FOR_WRITE sync of a clean range is skipped. Copies done through the planner
+ * mark their destination range dirty; data written directly by the host must
+ * be reported with mark_dirty(). Buffers registered with set_cacheable(), such
+ * as inputs flagged with NpuRunner::set_input_cacheable_attribute(), are
+ * synchronized once and then skipped until marked dirty.
+ *
+ * A SyncPlanner is meant to be reused across jobs. It is not thread-safe.
+ */
+class SyncPlanner {
+ public:
+  /**
+   * @brief Constructs a SyncPlanner.
+   *
+   * @param config Planner configuration.
+   */
+  explicit SyncPlanner(const SyncPlannerConfig& config = {});
+
+  ~SyncPlanner();
+
+  SyncPlanner(const SyncPlanner& other) = delete;
+  SyncPlanner& operator=(const SyncPlanner& other) = delete;
+
+  /**
+   * @brief Requests a cache sync of a range of a buffer.
+   *
+   * FOR_WRITE syncs are issued by flush_for_device(), FOR_READ syncs by
+   * flush_for_host().
+   *
+   * @param buffer Buffer to synchronize.
+   * @param direction Direction of the sync.
+   * @param offset Offset of the range in bytes.
+   * @param size Size of the range in bytes.
+   */
+  void add_sync(TensorBuffer* buffer,
+                SyncDirection direction,
+                uint64_t offset,
+                size_t size);
+
+  /**
+   * @brief Requests a copy from host memory to a buffer.
+   *
+   * Issued by flush_for_device(), before the FOR_WRITE syncs. The destination
+   * range is marked dirty and synchronized for the device, even on a cacheable
+   * buffer: the planner does not compare the copied content. Copy stable
+   * inputs once and do not request the copy again for later jobs.
+   *
+   * @param buffer Destination buffer.
+   * @param batch_idx Batch index in the destination buffer.
+   * @param src Source host memory.
+   * @param size Size of the copy in bytes.
+   * @param offset Offset in the destination batch entry in bytes.
+   */
+  void add_copy_from_host(TensorBuffer* buffer,
+                          size_t batch_idx,
+                          const void* src,
+                          size_t size,
+                          size_t offset);
+
+  /**
+   * @brief Requests a copy from a buffer to host memory.
+   *
+   * Issued by flush_for_host(), after the FOR_READ syncs. The source range is
+   * synchronized for the host.
+   *
+   * @param buffer Source buffer.
+   * @param batch_idx Batch index in the source buffer.
+   * @param dst Destination host memory.
+   * @param size Size of the copy in bytes.
+   * @param offset Offset in the source batch entry in bytes.
+   */
+  void add_copy_to_host(TensorBuffer* buffer,
+                        size_t batch_idx,
+                        void* dst,
+                        size_t size,
+                        size_t offset);
+
+  /**
+   * @brief Reports that the host wrote a range of a buffer directly.
+   *
+   * @param buffer Buffer written by the host.
+   * @param offset Offset of the range in bytes.
+   * @param size Size of the range in bytes.
+   */
+  void mark_dirty(TensorBuffer* buffer, uint64_t offset, size_t size);
+
+  /**
+   * @brief Declares whether the content of a buffer is stable across jobs.
+   *
+   * The ranges of a cacheable buffer stay clean after their first FOR_WRITE
+   * sync until they are marked dirty. Buffers are not cacheable by default:
+   * all their ranges become dirty again after each flush_for_host().
+   *
+   * @param buffer Buffer to configure.
+   * @param cacheable true if the buffer content is stable.
+   */
+  void set_cacheable(TensorBuffer* buffer, bool cacheable);
+
+  /**
+   * @brief Issues the pending host-to-device copies and FOR_WRITE syncs.
+   *
+   * Call before submitting the job to the device.
+   */
+  void flush_for_device();
+
+  /**
+   * @brief Issues the pending FOR_READ syncs and device-to-host copies.
+   *
+   * Call after the job has completed.
+   */
+  void flush_for_host();
+
+  /**
+   * @brief Forgets the state of a buffer, before it is destroyed or reused
+   * for other data.
+   *
+   * @param buffer Buffer to forget.
+   */
+  void remove(TensorBuffer* buffer);
+
+  /**
+   * @brief Returns the planner counters.
+   *
+   * @return SyncPlannerStats A snapshot of the counters.
+   */
+  SyncPlannerStats get_stats() const;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;  // Pending requests and clean range tracking
+};
+
+}  // namespace vart
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "vart_npu_tensor.hpp"
+#include "vart_runner_factory.hpp"
+
+namespace vart {
+
+/**
+ * @struct TensorPoolConfig
+ * @brief Configuration of a TensorPool.
+ *
+ * @var TensorPoolConfig::alignment
+ *   Alignment of every buffer in bytes. Buffer sizes are rounded up to a
+ * multiple of the alignment to form size classes. Defaults to the page size.
+ * @var TensorPoolConfig::buffers_per_size_class
+ *   Number of buffers preallocated for each size class when the pool is
+ * created.
+ * @var TensorPoolConfig::thread_cache_size
+ *   Maximum number of free buffers per size class kept in each thread's local
+ * cache. Acquiring and releasing from the local cache takes no lock.
+ * @var TensorPoolConfig::max_buffers_per_size_class
+ *   Maximum number of buffers of a size class, free or in use. Zero means the
+ * pool grows without limit when all buffers are in use.
+ * @var TensorPoolConfig::lock_pages
+ *   When true, buffers are locked in physical memory (pinned) so that they are
+ * never paged out.
+ */
+struct TensorPoolConfig {
+  size_t alignment = 4096;
+  uint32_t buffers_per_size_class = 4;
+  uint32_t thread_cache_size = 2;
+  uint32_t max_buffers_per_size_class = 0;
+  bool lock_pages = false;
+};
+
+/**
+ * @struct TensorPoolStats
+ * @brief Usage counters of a TensorPool, used to size pools in production.
+ *
+ * @var TensorPoolStats::hits
+ *   Acquisitions served by a free buffer, including thread cache hits.
+ * @var TensorPoolStats::thread_cache_hits
+ *   Acquisitions served by the calling thread's local cache.
+ * @var TensorPoolStats::misses
+ *   Acquisitions that had to allocate a new buffer.
+ * @var TensorPoolStats::failures
+ *   Acquisitions that failed because max_buffers_per_size_class was reached.
+ * @var TensorPoolStats::buffers_in_use
+ *   Number of buffers currently held by tensors.
+ * @var TensorPoolStats::high_water_buffers
+ *   Largest number of buffers held by tensors at the same time.
+ * @var TensorPoolStats::bytes_allocated
+ *   Total size of the buffers owned by the pool, free or in use.
+ * @var TensorPoolStats::high_water_bytes
+ *   Largest value reached by bytes_allocated.
+ */
+struct TensorPoolStats {
+  uint64_t hits;
+  uint64_t thread_cache_hits;
+  uint64_t misses;
+  uint64_t failures;
+  uint64_t buffers_in_use;
+  uint64_t high_water_buffers;
+  size_t bytes_allocated;
+  size_t high_water_bytes;
+};
+
+/**
+ * @class TensorPool
+ * @brief Pool of preallocated, page-aligned I/O tensor buffers.
+ *
+ * TensorPool preallocates host buffers bucketed by size class, one class per
+ * distinct NpuTensorInfo::size_in_bytes rounded up to the alignment. acquire()
+ * returns an owning NpuTensor whose buffer goes back to the pool when the
+ * tensor is destroyed, so a steady-state inference loop allocates no buffer.
+ * Each acquired tensor holds a copy of its NpuTensorInfo, which may allocate
+ * for the name, shape and strides; refilling a caller-owned batch with
+ * acquire_batch(infos, batch_size, tensors, type) avoids this for the tensors
+ * that are kept from one job to the next.
+ *
+ * Freed buffers first go to a small cache local to the releasing thread, then
+ * to the shared free list of their size class.
+ *
+ * Tensors may outlive the TensorPool handle. The releaser context of each
+ * pooled tensor is the pool state, which carries an atomic reference count:
+ * one reference for the TensorPool object and one for each buffer in use.
+ * acquire() takes a reference and the releaser drops it, so the pool state
+ * and its buffers are freed when both the pool and the last tensor holding
+ * one of its buffers are destroyed.
+ *
+ * Allocation failures are reported with std::bad_alloc by all methods.
+ */
+class TensorPool {
+ public:
+  /**
+   * @brief Creates a pool for the given tensors.
+   *
+   * @param infos Tensors to preallocate size classes for.
+   * @param config Pool configuration.
+   * @return std::shared_ptr<TensorPool> The created pool.
+   * @throw std::bad_alloc if the preallocation failed.
+   */
+  static std::shared_ptr<TensorPool> create(
+      const std::vector<NpuTensorInfo>& infos,
+      const TensorPoolConfig& config = {});
+
+  /**
+   * @brief Creates a pool for all input and output tensors of a runner.
+   *
+   * Preallocates buffers_per_size_class x get_batch_size() buffers for every
+   * input and output tensor of the given type.
+   *
+   * @param runner Runner whose tensors the pool serves.
+   * @param type Tensor type (CPU or HW) of the tensor information to use.
+   * @param config Pool configuration.
+   * @return std::shared_ptr<TensorPool> The created pool.
+   * @throw std::bad_alloc if the preallocation failed.
+   */
+  static std::shared_ptr<TensorPool> create(const Runner& runner,
+                                            const TensorType& type,
+                                            const TensorPoolConfig& config = {});
+
+  ~TensorPool();
+
+  TensorPool(const TensorPool& other) = delete;
+  TensorPool& operator=(const TensorPool& other) = delete;
+
+  /**
+   * @brief Acquires a tensor with a pooled buffer.
+   *
+   * @param info Metadata of the tensor. The buffer size is
+   * info.size_in_bytes.
+   * @param type Tensor type (CPU or HW) of the returned tensor.
+   * @return NpuTensor An owning MemoryType::HOST tensor. Its buffer returns to
+   * the pool when the tensor is destroyed.
+   * @throw std::bad_alloc if max_buffers_per_size_class buffers of the size
+   * class are already in use.
+   */
+  NpuTensor acquire(const NpuTensorInfo& info,
+                    const TensorType& type = TensorType::CPU);
+
+  /**
+   * @brief Acquires tensors for all inputs or outputs of one runner job.
+   *
+   * @param infos Tensor information, as returned by Runner::get_tensors_info().
+   * @param batch_size Number of batch entries.
+   * @param type Tensor type (CPU or HW) of the returned tensors.
+   * @return Tensors ready to be passed to Runner::execute(), vector dimensions:
+   * [batch][tensors].
+   * @throw std::bad_alloc if a size class has reached
+   * max_buffers_per_size_class buffers in use.
+   */
+  std::vector<std::vector<NpuTensor>> acquire_batch(
+      const std::vector<NpuTensorInfo>& infos,
+      size_t batch_size,
+      const TensorType& type = TensorType::CPU);
+
+  /**
+   * @brief Refills a caller-owned batch of tensors for one runner job.
+   *
+   * tensors is resized to [batch_size][infos.size()]. Entries that still own
+   * a buffer of the size class of their tensor information are kept as is.
+   * Entries that do not own a buffer, such as tensors moved to another stage
+   * of the pipeline, and entries added by the resize are replaced by newly
+   * acquired tensors. The vectors keep their capacity, so once the batch has
+   * reached its size, a job that moves no tensor out performs no allocation.
+   *
+   * @param infos Tensor information, as returned by Runner::get_tensors_info().
+   * @param batch_size Number of batch entries.
+   * @param tensors Batch to refill, vector dimensions: [batch][tensors].
+   * @param type Tensor type (CPU or HW) of the acquired tensors.
+   * @throw std::bad_alloc if a size class has reached
+   * max_buffers_per_size_class buffers in use. The entries refilled before the
+   * failure are kept.
+   */
+  void acquire_batch(const std::vector<NpuTensorInfo>& infos,
+                     size_t batch_size,
+                     std::vector<std::vector<NpuTensor>>& tensors,
+                     const TensorType& type = TensorType::CPU);
+
+  /**
+   * @brief Returns the usage counters of the pool.
+   *
+   * @return TensorPoolStats A snapshot of the counters.
+   */
+  TensorPoolStats get_stats() const;
+
+  /**
+   * @brief Resets the hit, miss and failure counters, and sets the high-water
+   * marks to the current usage.
+   */
+  void reset_stats();
+
+  /**
+   * @brief Frees buffers not currently in use, keeping at most
+   * buffers_per_size_class free buffers per size class.
+   */
+  void trim();
+
+ private:
+  explicit TensorPool(const TensorPoolConfig& config);
+
+  struct Impl;
+  Impl* impl_;  // Reference counted, released by the pool and live tensors
+};
+
+}  // namespace vart
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "vart_npu_tensor.hpp"
+#include "vart_result_arena.hpp"
+#include "vart_runner_factory.hpp"
+
+namespace vart {
+
+/**
+ * @struct TiledExecutorConfig
+ * @brief Configuration of a TiledExecutor.
+ *
+ * Tiles have the height and width of the model input. The source image is cut
+ * with a stride of tile size minus overlap; the last row and column of tiles
+ * are aligned on the image edges. Along a dimension where the image is smaller
+ * than the model input, there is a single tile, padded with zeros after the
+ * image edge.
+ *
+ * @var TiledExecutorConfig::overlap_x
+ *   Horizontal overlap between adjacent tiles, in pixels.
+ * @var TiledExecutorConfig::overlap_y
+ *   Vertical overlap between adjacent tiles, in pixels.
+ * @var TiledExecutorConfig::num_buffers
+ *   Number of tiles in flight. 2 double-buffers the tiles: the outputs of one
+ * tile are merged while the next one executes.
+ * @var TiledExecutorConfig::nms_iou_threshold
+ *   IoU above which two detections of the same label from different tiles are
+ * considered the same object. Used by run_detect().
+ * @var TiledExecutorConfig::timeout
+ *   Timeout of each tile job in milliseconds.
+ */
+struct TiledExecutorConfig {
+  uint32_t overlap_x = 0;
+  uint32_t overlap_y = 0;
+  uint32_t num_buffers = 2;
+  float nms_iou_threshold = 0.5f;
+  unsigned int timeout = 1000;
+};
+
+/**
+ * @struct TileInfo
+ * @brief Position of a tile in the source image.
+ *
+ * @var TileInfo::index
+ *   Index of the tile, in row-major order.
+ * @var TileInfo::x
+ *   Column of the top-left pixel of the tile.
+ * @var TileInfo::y
+ *   Row of the top-left pixel of the tile.
+ * @var TileInfo::width
+ *   Width of the image area covered by the tile, in pixels. Less than the
+ * model input width only for a padded tile.
+ * @var TileInfo::height
+ *   Height of the image area covered by the tile, in pixels. Less than the
+ * model input height only for a padded tile.
+ */
+struct TileInfo {
+  uint32_t index;
+  uint32_t x;
+  uint32_t y;
+  uint32_t width;
+  uint32_t height;
+};
+
+/**
+ * @struct TiledExecutorStats
+ * @brief Statistics of the last run of a TiledExecutor.
+ *
+ * @var TiledExecutorStats::num_tiles
+ *   Number of tiles executed.
+ * @var TiledExecutorStats::runner_busy_ratio
+ *   Fraction of the run during which at least one tile job was in flight.
+ * @var TiledExecutorStats::merge_us
+ *   Total time spent merging tile outputs, in microseconds.
+ * @var TiledExecutorStats::merged_duplicates
+ *   Number of detections suppressed across tile boundaries.
+ * @var TiledExecutorStats::peak_memory_bytes
+ *   Peak memory allocated by the executor, excluding the source and
+ * destination images.
+ */
+struct TiledExecutorStats {
+  uint32_t num_tiles;
+  double runner_busy_ratio;
+  uint64_t merge_us;
+  uint64_t merged_duplicates;
+  size_t peak_memory_bytes;
+};
+
+/**
+ * @class TiledExecutor
+ * @brief Runs a model over an image larger than its input, tile by tile.
+ *
+ * The source image is a host NpuTensor in NHWC layout. Each tile is passed to
+ * the runner as a strided view into the source, a tensor whose shape is the
+ * model input shape and whose strides are those of the source image; no tile
+ * is copied on the host, except padded tiles of an image smaller than the
+ * model input, which are copied into a zero-filled staging tensor. Tiles are
+ * submitted with Runner::execute_async(), num_buffers at a time, and their
+ * outputs are merged as they complete.
+ *
+ * The memory used by run_blend() is num_buffers sets of output tensors and
+ * does not depend on the image size. run_detect() also keeps the detections
+ * lying in the overlap band between the current row of tiles and the next
+ * one, until the tiles of the next row have completed; detections outside
+ * the overlap bands are written to the results as soon as their tile
+ * completes. This buffer grows linearly with the image width and the
+ * detection density, and does not depend on the image height.
+ *
+ * The runner must accept strided CPU input tensors ("input_tensor_type"
+ * "CPU"), as described for Runner::execute(); RunnerType::VAIML and
+ * RunnerType::CPU_REF runners do.
+ */
+class TiledExecutor {
+ public:
+  /**
+   * @brief Decodes the outputs of one tile into detections.
+   *
+   * Called in tile order on the thread calling run_detect(). The detections
+   * must be added to the arena as frame 0, in tile coordinates; the executor
+   * translates them into image coordinates.
+   *
+   * @param tile Position of the tile.
+   * @param outputs Output tensors of the tile.
+   * @param results Arena receiving the detections of the tile.
+   */
+  using TileDecoder = std::function<void(const TileInfo& tile,
+                                         const std::vector<NpuTensor>& outputs,
+                                         ResultArena& results)>;
+
+  /**
+   * @brief Constructs a TiledExecutor.
+   *
+   * @param runner Runner executing the tiles. Its model must have one input.
+   * @param config Executor configuration.
+   */
+  TiledExecutor(std::shared_ptr<Runner> runner,
+                const TiledExecutorConfig& config = {});
+
+  ~TiledExecutor();
+
+  TiledExecutor(const TiledExecutor& other) = delete;
+  TiledExecutor& operator=(const TiledExecutor& other) = delete;
+
+  /**
+   * @brief Returns the tiles covering an image.
+   *
+   * @param width Image width in pixels.
+   * @param height Image height in pixels.
+   * @return std::vector<TileInfo> The tiles, in row-major order.
+   */
+  std::vector<TileInfo> plan(uint32_t width, uint32_t height) const;
+
+  /**
+   * @brief Runs a dense model, such as a segmentation model, over an image.
+   *
+   * The output of each tile is written into the destination image, with
+   * overlapping areas blended by linearly weighting each tile towards its
+   * center.
+   *
+   * The output scale is the ratio of the model output height and width to the
+   * model input height and width, for example 1/8 for a head of stride 8, or
+   * 1 for a full-resolution head. Tile positions and overlaps are multiplied
+   * by the scale in the destination image, and the output of the padded area
+   * of a tile is discarded.
+   *
+   * @param src Source image, NHWC host tensor.
+   * @param dst Destination image, NHWC host tensor with the channels of the
+   * model output and the height and width of src multiplied by the output
+   * scale, rounded up.
+   * @return StatusCode SUCCESS, or the first error reported by the runner.
+   * @throw std::invalid_argument if the model output is not a single NHWC
+   * tensor, if dst does not have the expected shape, or if the tile stride and
+   * overlaps multiplied by the output scale are not whole numbers of output
+   * pixels.
+   */
+  StatusCode run_blend(const NpuTensor& src, NpuTensor& dst);
+
+  /**
+   * @brief Runs a detection model over an image.
+   *
+   * Detections of overlapping tiles are merged with non-maximum suppression
+   * as soon as all the tiles covering an overlap area have completed.
+   * Detections in the padded area of a tile are clipped to the image.
+   *
+   * @param src Source image, NHWC host tensor.
+   * @param decoder Decoder of the outputs of each tile.
+   * @param results Arena receiving the merged detections in image coordinates,
+   * as frame 0. It is reset first.
+   * @return StatusCode SUCCESS, or the first error reported by the runner.
+   */
+  StatusCode run_detect(const NpuTensor& src,
+                        const TileDecoder& decoder,
+                        ResultArena& results);
+
+  /**
+   * @brief Returns the statistics of the last run.
+   *
+   * @return TiledExecutorStats Statistics of the last run_blend() or
+   * run_detect().
+   */
+  TiledExecutorStats get_stats() const;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;  // Tile buffers and merge state
+};
+
+}  // namespace vart
@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vart_stats.hpp"
+
+namespace vart {
+
+/**
+ * @enum SpanType
+ * @brief Enumerates the kinds of spans recorded by the Tracer.
+ *
+ * - SUBMIT:          Submission of a job to the runner, until the call returns.
+ * - QUEUE:           Time a job waits in a runner or scheduler queue.
+ * - DEVICE_EXECUTE:  Execution of a job on the device.
+ * - WAIT:            Time spent blocked in Runner::wait() or an equivalent.
+ * - PRE_PROCESS:     PreProcess::process() of a frame.
+ * - POST_PROCESS:    PostProcess::process() of a batch.
+ * - HOST_CONVERSION: Data type or layout conversion on the host.
+ * - USER:            Span recorded by the application.
+ */
+enum class SpanType {
+  SUBMIT,
+  QUEUE,
+  DEVICE_EXECUTE,
+  WAIT,
+  PRE_PROCESS,
+  POST_PROCESS,
+  HOST_CONVERSION,
+  USER,
+};
+
+/**
+ * @struct TraceConfig
+ * @brief Configuration of the Tracer.
+ *
+ * @var TraceConfig::spans_per_thread
+ *   Capacity of the span buffer of each thread, allocated when the thread
+ * records its first span after enable(). When a buffer is full, the oldest
+ * spans are overwritten.
+ * @var TraceConfig::summary_interval_ms
+ *   Interval in milliseconds between two summaries written through the Logger
+ * context of each component, at LOG_LEVEL_INFO. 0 disables periodic
+ * summaries.
+ */
+struct TraceConfig {
+  size_t spans_per_thread = 64 * 1024;
+  uint32_t summary_interval_ms = 0;
+};
+
+/**
+ * @struct SpanSummary
+ * @brief Latency distribution of one span type of one component.
+ *
+ * @var SpanSummary::component
+ *   Name of the component, as registered with Tracer::register_component().
+ * @var SpanSummary::type
+ *   Span type.
+ * @var SpanSummary::latency
+ *   Summary of the span durations.
+ * @var SpanSummary::histogram
+ *   Distribution of the span durations in microseconds, over logarithmic
+ * buckets with 3 significant digits of precision (HDR histogram).
+ */
+struct SpanSummary {
+  std::string component;
+  SpanType type;
+  LatencySummary latency;
+  Histogram histogram;
+};
+
+/**
+ * @class Tracer
+ * @brief Process-wide, low-overhead span recorder for the inference stack.
+ *
+ * VART components record spans covering job submission, queueing, device
+ * execution, waits, pre- and post-processing and host conversions. Spans are
+ * written to buffers owned by the recording thread. A thread allocates its
+ * buffer when it records its first span after enable(); every later span is
+ * recorded without locks or allocation.
+ *
+ * Recorded spans can be exported as Chrome trace-event JSON, viewable in
+ * chrome://tracing or Perfetto, and are aggregated into per-component latency
+ * histograms.
+ *
+ * Tracing is disabled by default. record() and ScopedSpan are inline and test
+ * is_enabled() first, so when tracing is disabled, recording a span costs one
+ * relaxed atomic load and no library call. The overhead when enabled can be
+ * measured by running RunnerBenchmark with tracing enabled and disabled.
+ */
+class Tracer {
+ public:
+  /**
+   * @brief Alias for the identifier of a registered component.
+   */
+  using ComponentId = uint16_t;
+
+  /**
+   * @brief Returns the process-wide tracer.
+   *
+   * @return A reference to the Tracer instance.
+   */
+  static Tracer& get_instance();
+
+  /**
+   * @brief Enables span recording.
+   *
+   * Can also be enabled by setting the VART_TRACE environment variable to 1
+   * before the process starts.
+   *
+   * @param config Tracer configuration.
+   */
+  void enable(const TraceConfig& config = {});
+
+  /**
+   * @brief Disables span recording. Recorded spans are kept.
+   */
+  void disable();
+
+  /**
+   * @brief Indicates whether span recording is enabled.
+   *
+   * @return true if spans are recorded.
+   */
+  static bool is_enabled() {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Registers a component recording spans.
+   *
+   * The component is also registered through Logger::mod_register(), and the
+   * returned context is used for its periodic summaries. Registering the same
+   * name twice returns the same identifier.
+   *
+   * @param modname Name of the component.
+   * @return ComponentId The identifier of the component.
+   */
+  ComponentId register_component(const char* modname);
+
+  /**
+   * @brief Records a completed span.
+   *
+   * Does nothing when tracing is disabled.
+   *
+   * @param component Component the span belongs to.
+   * @param type Span type.
+   * @param start_ns Start time in nanoseconds of the steady clock.
+   * @param end_ns End time in nanoseconds of the steady clock.
+   * @param id Correlation identifier, such as JobHandle::job_id, used to
+   * connect the spans of the same job in the exported trace.
+   */
+  void record(ComponentId component,
+              SpanType type,
+              uint64_t start_ns,
+              uint64_t end_ns,
+              uint64_t id = 0) {
+    if (!is_enabled()) {
+      return;
+    }
+    record_span(component, type, start_ns, end_ns, id);
+  }
+
+  /**
+   * @brief Writes the recorded spans as Chrome trace-event JSON.
+   *
+   * @param path Output file path.
+   * @return true if the file was written.
+   */
+  bool export_chrome_trace(const std::string& path) const;
+
+  /**
+   * @brief Returns the latency summaries of the recorded spans.
+   *
+   * @return One SpanSummary per component and span type with at least one
+   * span.
+   */
+  std::vector<SpanSummary> get_summaries() const;
+
+  /**
+   * @brief Discards all recorded spans and summaries.
+   */
+  void reset();
+
+ private:
+  Tracer();
+  ~Tracer();
+  Tracer(const Tracer&) = delete;
+  void operator=(const Tracer&) = delete;
+
+  // Writes a span to the buffer of the calling thread, allocating the buffer
+  // on the first span of the thread.
+  void record_span(ComponentId component,
+                   SpanType type,
+                   uint64_t start_ns,
+                   uint64_t end_ns,
+                   uint64_t id);
+
+  struct Impl;
+  static inline std::atomic<bool> enabled_{false};  // Checked on every span
+  std::unique_ptr<Impl> impl_;  // Per-thread buffers and histograms
+};
+
+/**
+ * @class ScopedSpan
+ * @brief Records a span covering the lifetime of the object.
+ *
+ * @code
+ *   {
+ *     vart::ScopedSpan span(component, vart::SpanType::POST_PROCESS);
+ *     results = postprocess->process(data, batch_size);
+ *   }
+ * @endcode
+ */
+class ScopedSpan {
+ public:
+  /**
+   * @brief Starts a span. Reads the clock only when tracing is enabled.
+   *
+   * @param component Component the span belongs to.
+   * @param type Span type.
+   * @param id Correlation identifier of the span.
+   */
+  ScopedSpan(Tracer::ComponentId component, SpanType type, uint64_t id = 0)
+      : component_(component),
+        type_(type),
+        id_(id),
+        start_ns_(Tracer::is_enabled() ? now_ns() : 0) {}
+
+  /**
+   * @brief Ends the span and records it.
+   *
+   * Nothing is recorded if tracing was disabled when the span started.
+   */
+  ~ScopedSpan() {
+    if (start_ns_ != 0) {
+      Tracer::get_instance().record(component_, type_, start_ns_, now_ns(),
+                                    id_);
+    }
+  }
+
+  ScopedSpan(const ScopedSpan&) = delete;
+  ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+ private:
+  // Current time in nanoseconds of the steady clock.
+  static uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  Tracer::ComponentId component_;  // Component the span belongs to
+  SpanType type_;                  // Span type
+  uint64_t id_;                    // Correlation identifier
+  uint64_t start_ns_;              // Start time, 0 when tracing is disabled
+};
+
+}  // namespace vart
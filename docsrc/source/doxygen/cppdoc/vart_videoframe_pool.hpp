@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2025 Advanced Micro Devices, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "vart_device.hpp"
+#include "vart_videoframe.hpp"
+
+namespace vart {
+
+/**
+ * @enum FrameSyncPolicy
+ * @brief Enumerates how pooled frames keep host and device views coherent.
+ *
+ * - SYNC_ONLY: Frames stay mapped for the lifetime of the pool.
+ * VideoFrame::map() only synchronizes the host cache with device memory for
+ * the requested direction, and VideoFrame::unmap() only flushes data written
+ * by the host.
+ * - COHERENT:  Frames are allocated in cache-coherent memory and stay mapped.
+ * map() and unmap() do nothing.
+ * - REMAP:     map() and unmap() map and unmap the buffers on every call, as
+ * for frames created outside a pool.
+ */
+enum class FrameSyncPolicy { SYNC_ONLY, COHERENT, REMAP };
+
+/**
+ * @struct VideoFramePoolConfig
+ * @brief Configuration of a VideoFramePool.
+ *
+ * @var VideoFramePoolConfig::impl_type
+ *   Implementation of the pooled frames. Defaults to VideoFrameImplType::XRT.
+ * @var VideoFramePoolConfig::vinfo
+ *   Resolution and format of the pooled frames.
+ * @var VideoFramePoolConfig::mbank_idx
+ *   Memory bank the frames are allocated from.
+ * @var VideoFramePoolConfig::num_frames
+ *   Number of frames preallocated when the pool is created.
+ * @var VideoFramePoolConfig::max_frames
+ *   Maximum number of frames. 0 means num_frames. When all frames are in use
+ * and the pool owns fewer than max_frames frames, acquire() allocates and
+ * maps a new frame instead of waiting; when it owns max_frames frames,
+ * acquire() waits for a frame to be released. Frames added this way stay in
+ * the pool until it is destroyed; the pool never shrinks.
+ * @var VideoFramePoolConfig::sync_policy
+ *   Coherence policy of the pooled frames.
+ */
+struct VideoFramePoolConfig {
+  VideoFrameImplType impl_type = VideoFrameImplType::XRT;
+  VideoInfo vinfo;
+  uint8_t mbank_idx = 0;
+  uint32_t num_frames = 4;
+  uint32_t max_frames = 0;
+  FrameSyncPolicy sync_policy = FrameSyncPolicy::SYNC_ONLY;
+};
+
+/**
+ * @struct VideoFramePoolStats
+ * @brief Occupancy metrics of a VideoFramePool.
+ *
+ * @var VideoFramePoolStats::num_frames
+ *   Number of frames owned by the pool.
+ * @var VideoFramePoolStats::frames_in_use
+ *   Number of frames currently leased.
+ * @var VideoFramePoolStats::high_water_frames
+ *   Largest number of frames leased at the same time.
+ * @var VideoFramePoolStats::acquisitions
+ *   Number of leases handed out.
+ * @var VideoFramePoolStats::waits
+ *   Number of acquisitions that had to wait for a frame to be released.
+ * @var VideoFramePoolStats::remaps
+ *   Number of buffer mappings created. Stays equal to the number of frames
+ * with the SYNC_ONLY and COHERENT policies.
+ */
+struct VideoFramePoolStats {
+  uint32_t num_frames;
+  uint32_t frames_in_use;
+  uint32_t high_water_frames;
+  uint64_t acquisitions;
+  uint64_t waits;
+  uint64_t remaps;
+};
+
+/**
+ * @class VideoFramePool
+ * @brief Pool of preallocated, persistently mapped video frames.
+ *
+ * Allocating a VideoFrame and mapping its buffers for every frame costs
+ * allocations and system calls that add up with many streams. A
+ * VideoFramePool preallocates frames for one VideoInfo and memory bank, maps
+ * them once and hands out leases. A lease is a std::shared_ptr<VideoFrame>
+ * that returns the frame to the pool when its last reference is released.
+ *
+ * The pool may be destroyed while leases are outstanding; the remaining frames
+ * are freed when they are released.
+ */
+class VideoFramePool {
+ public:
+  /**
+   * @brief Creates a pool and preallocates its frames.
+   *
+   * @param config Pool configuration.
+   * @param device Handle to the device the frames are allocated on.
+   * @return std::shared_ptr<VideoFramePool> The created pool.
+   * @throw std::bad_alloc if the frames cannot be allocated.
+   */
+  static std::shared_ptr<VideoFramePool> create(
+      const VideoFramePoolConfig& config,
+      std::shared_ptr<Device> device);
+
+  ~VideoFramePool();
+
+  VideoFramePool(const VideoFramePool& other) = delete;
+  VideoFramePool& operator=(const VideoFramePool& other) = delete;
+
+  /**
+   * @brief Leases a frame from the pool.
+   *
+   * @param timeout The maximum time to wait in milliseconds for a frame when
+   * all frames are in use.
+   * @return std::shared_ptr<VideoFrame> The leased frame, or nullptr if the
+   * timeout expired.
+   */
+  std::shared_ptr<VideoFrame> acquire(unsigned int timeout = 1000);
+
+  /**
+   * @brief Returns the configuration of the pool.
+   *
+   * @return A constant reference to the configuration.
+   */
+  const VideoFramePoolConfig& get_config() const;
+
+  /**
+   * @brief Returns the occupancy metrics of the pool.
+   *
+   * @return VideoFramePoolStats A snapshot of the metrics.
+   */
+  VideoFramePoolStats get_stats() const;
+
+ private:
+  explicit VideoFramePool(const VideoFramePoolConfig& config);
+
+  struct Impl;
+  std::shared_ptr<Impl> impl_;  // Shared with outstanding leases
+};
+
+}  // namespace vart